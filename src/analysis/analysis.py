@@ -114,6 +114,83 @@ def solved_instances_to_optimality(results):
         print("Optimal instances for {0}: {1}".format(solver_name, len(optimal_results)))
 
 
+def get_best_objective_values(results):
+    instance_name_to_best_objective_value = dict()
+    for solver_results in results.results.values():
+        for instance_name, result in solver_results.items():
+            if has_solution(result):
+                best_objective_value = instance_name_to_best_objective_value.get(instance_name, result["objectiveValue"])
+                instance_name_to_best_objective_value[instance_name] = min(best_objective_value, result["objectiveValue"])
+
+    return instance_name_to_best_objective_value
+
+
+def time_to_target(result, target):
+    # The trace is recorded only with convergenceTraceCapacity set in the solver prescription.
+    for entry in result.get("convergenceTrace", []):
+        if "objectiveValue" in entry and entry["objectiveValue"] <= target:
+            return entry["timeInMilliseconds"]
+
+    return None
+
+
+def get_times_to_target(results, tolerance):
+    # Target of an instance is the best objective value found by any solver, relaxed by the tolerance.
+    instance_name_to_best_objective_value = get_best_objective_values(results)
+    solver_name_to_times = dict()
+    for solver_name, solver_results in results.results.items():
+        solver_name_to_times[solver_name] = dict()
+        for instance_name, best_objective_value in instance_name_to_best_objective_value.items():
+            result = solver_results.get(instance_name)
+            time = None
+            if result is not None:
+                time = time_to_target(result, best_objective_value * (1.0 + tolerance))
+            solver_name_to_times[solver_name][instance_name] = time
+
+    return solver_name_to_times
+
+
+def figs_time_to_target(results, tolerance=0.0):
+    solver_name_to_times = get_times_to_target(results, tolerance)
+    for solver_name in results.solver_order:
+        instance_name_to_time = solver_name_to_times[solver_name]
+        times = sorted(time for time in instance_name_to_time.values() if time is not None)
+        fractions = np.arange(1, len(times) + 1) / max(1, len(instance_name_to_time))
+        plt.step(times, fractions, where="post", label=results.friendly_solver_names.get(solver_name, solver_name))
+
+    plt.xlabel("time to target [ms]")
+    plt.ylabel("fraction of instances")
+    plt.legend()
+
+
+def figs_performance_profiles(results, tolerance=0.0):
+    # Performance ratio of a solver is its time to target divided by the fastest time to target on the instance.
+    solver_name_to_times = get_times_to_target(results, tolerance)
+    solver_name_to_ratios = {solver_name: [] for solver_name in results.solver_order}
+    for instance_name in get_best_objective_values(results).keys():
+        times = [solver_name_to_times[solver_name].get(instance_name) for solver_name in results.solver_order]
+        reached_times = [time for time in times if time is not None]
+        if len(reached_times) == 0:
+            continue
+
+        # Times are in whole milliseconds, so the fastest one is at least one millisecond.
+        fastest_time = max(1, min(reached_times))
+        for solver_name, time in zip(results.solver_order, times):
+            ratio = np.inf if time is None else max(1, time) / fastest_time
+            solver_name_to_ratios[solver_name].append(ratio)
+
+    for solver_name in results.solver_order:
+        ratios = np.sort(np.array(solver_name_to_ratios[solver_name]))
+        finite_ratios = ratios[np.isfinite(ratios)]
+        fractions = np.arange(1, len(finite_ratios) + 1) / max(1, len(ratios))
+        plt.step(finite_ratios, fractions, where="post", label=results.friendly_solver_names.get(solver_name, solver_name))
+
+    plt.xscale("log")
+    plt.xlabel("performance ratio of time to target")
+    plt.ylabel("fraction of instances")
+    plt.legend()
+
+
 def main():
     results_path = os.path.join(ROOT_EXPERIMENT_DATA_PATH, "experiments", "n=15", "results")
     friendly_solver_names = {"tabu1": "Tabu", "greedy": "Greedy", "lazy": "Lazy", "random": "Random", "bab": "BranchAndBound"}
@@ -122,6 +199,11 @@ def main():
     figs_objective_values_boxplots(results)
     solved_instances_to_optimality(results)
 
+    plt.figure()
+    figs_time_to_target(results)
+    plt.figure()
+    figs_performance_profiles(results)
+
     plt.show()
 
 
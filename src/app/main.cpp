@@ -26,9 +26,10 @@
 #include <vector>
 #include <boost/filesystem.hpp>
 #include <iostream>
-#include "../rseclp/solvers/SolverResultJsonWriter.h"
-#include "../rseclp/instance/InstanceJsonReader.h"
+#include "../rseclp/solvers/SolverResultWriter.h"
+#include "../rseclp/instance/InstanceReader.h"
 #include "../rseclp/solvers/SolverPrescription.h"
+#include "../rseclp/utils/Profiler.h"
 
 using namespace std;
 using namespace rseclp;
@@ -44,10 +45,23 @@ int main(int argc, char **argv) {
     boost::filesystem::path resultPath = argv[3];
 
     unique_ptr<SolverPrescription> solverPrescription(SolverPrescription::read(solverPrescriptionPath));
-    unique_ptr<Instance> ins(rseclp::InstanceJsonReader::read(instancePath));
+
+    Telemetry::Registry telemetry(solverPrescription->getTelemetryTimers());
+    Telemetry::Scope telemetryScope(&telemetry);
+
+    unique_ptr<Instance> ins(rseclp::InstanceReader::read(instancePath));
     unique_ptr<Solver> solver(solverPrescription->createSolver(*ins));
 
+    ConvergenceTrace *convergenceTrace = solverPrescription->getConfig().getConvergenceTrace();
+    if (convergenceTrace != nullptr) {
+        convergenceTrace->start();
+    }
+
     auto result = solver->solve(solverPrescription->getConfig());
+    result.addTelemetry(telemetry.collect());
+    if (convergenceTrace != nullptr) {
+        result.setConvergenceTrace(convergenceTrace->getEntries());
+    }
     switch (result.getStatus()) {
         case Solver::Result::Status::NO_SOLUTION:
             cout << "Result status: no solution found" << endl;
@@ -72,7 +86,9 @@ int main(int argc, char **argv) {
 
     cout << "Solver runtime [ms]: " << result.getSolverRuntime().count() << endl;
 
-    SolverResultJsonWriter::write(result, resultPath);
+    SolverResultWriter::write(result, resultPath);
+
+    RSECLP_PROFILE_DUMP(cout);
 
     return 0;
 }
@@ -0,0 +1,190 @@
+/*
+    
+    Copyright (C) 2017 Czech Technical University in Prague
+    The MIT License (MIT)
+    
+    Permission is hereby granted, free of charge, to any person obtaining
+    a copy of this software and associated documentation files
+    (the "Software"), to deal in the Software without restriction,
+    including without limitation the rights to use, copy, modify, merge,
+    publish, distribute, sublicense, and/or sell copies of the Software,
+    and to permit persons to whom the Software is furnished to do so,
+    subject to the following conditions:
+    
+    The above copyright notice and this permission notice shall be
+    included in all copies or substantial portions of the Software.
+    
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+    EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+    MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+    IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+    CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+    TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+    SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+#include <iostream>
+#include <fstream>
+#include <map>
+#include <boost/filesystem.hpp>
+#include <rapidjson/document.h>
+#include "../rseclp/instance/DatasetArchiveWriter.h"
+#include "../rseclp/instance/InstanceBinaryReader.h"
+#include "../rseclp/instance/InstanceReader.h"
+#include "../rseclp/instance/InstanceWriter.h"
+#include "../rseclp/solvers/SolverResultBinaryReader.h"
+#include "../rseclp/solvers/SolverResultReader.h"
+#include "../rseclp/solvers/SolverResultWriter.h"
+#include "../rseclp/utils/JsonUtils.h"
+
+using namespace std;
+using namespace rseclp;
+using namespace boost::filesystem;
+using namespace rapidjson;
+
+enum FileKind {
+    INSTANCE,
+    RESULT,
+    OTHER
+};
+
+FileKind detectKind(const path &filePath) {
+    if (InstanceBinaryReader::isBinary(filePath)) {
+        return FileKind::INSTANCE;
+    }
+
+    if (SolverResultBinaryReader::isBinary(filePath)) {
+        return FileKind::RESULT;
+    }
+
+    if (filePath.extension() != ".json") {
+        return FileKind::OTHER;
+    }
+
+    Document doc;
+    JsonUtils::readJsonDocument(filePath, doc);
+    if (!doc.IsObject()) {
+        return FileKind::OTHER;
+    }
+    else if (doc.HasMember("numOperations") && doc.HasMember("maxEnergyConsumptions")) {
+        return FileKind::INSTANCE;
+    }
+    else if (doc.HasMember("status") && doc.HasMember("startTimes")) {
+        return FileKind::RESULT;
+    }
+    else {
+        return FileKind::OTHER;
+    }
+}
+
+// Returns false if the file is neither an instance nor a result.
+bool convert(const path &sourcePath, const path &targetPath) {
+    switch (detectKind(sourcePath)) {
+        case FileKind::INSTANCE: {
+            unique_ptr<Instance> ins(InstanceReader::read(sourcePath));
+            InstanceWriter::write(*ins, targetPath);
+            return true;
+        }
+
+        case FileKind::RESULT:
+            SolverResultWriter::write(SolverResultReader::read(sourcePath), targetPath);
+            return true;
+
+        case FileKind::OTHER:
+            return false;
+    }
+
+    return false;
+}
+
+// Packs <datasetDir>/<realisation>/instances/<repetition>.* into a single dataset archive.
+void pack(const path &datasetDir) {
+    map<pair<int, int>, path> instancePaths;
+    for (directory_iterator realisationPathIter(datasetDir); realisationPathIter != directory_iterator(); realisationPathIter++) {
+        path realisationPath = realisationPathIter->path();
+        if (!is_directory(realisationPath / "instances")) {
+            continue;
+        }
+
+        int realisationIndex = stoi(realisationPath.stem().string());
+        for (directory_iterator instancesPathIter(realisationPath / "instances"); instancesPathIter != directory_iterator(); instancesPathIter++) {
+            path instancePath = instancesPathIter->path();
+            int repetition = stoi(instancePath.stem().string());
+
+            auto key = make_pair(realisationIndex, repetition);
+            auto itInstancePath = instancePaths.find(key);
+            if (itInstancePath == instancePaths.end() || InstanceReader::isPreferred(instancePath, itInstancePath->second)) {
+                instancePaths[key] = instancePath;
+            }
+        }
+    }
+
+    DatasetArchiveWriter archive(datasetDir / DatasetArchiveReader::FILENAME);
+    for (auto &instancePath : instancePaths) {
+        unique_ptr<Instance> ins(InstanceReader::read(instancePath.second));
+        archive.add(instancePath.first.first, instancePath.first.second, *ins);
+    }
+    archive.close();
+
+    cout << "Packed " << instancePaths.size() << " instances." << endl;
+}
+
+int main(int argc, char **argv) {
+    if (argc != 3) {
+        cout << "Error: not every argument provided";
+        exit(1);
+    }
+
+    if (string(argv[1]) == "--archive") {
+        pack(argv[2]);
+        return 0;
+    }
+
+    path sourcePath = argv[1];
+    path targetPath = argv[2];
+
+    if (!is_directory(sourcePath)) {
+        if (exists(targetPath) && equivalent(sourcePath, targetPath)) {
+            cout << "Error: source and target are the same file" << endl;
+            exit(1);
+        }
+
+        if (!convert(sourcePath, targetPath)) {
+            cout << "Error: " << sourcePath << " is neither an instance nor a result" << endl;
+            exit(1);
+        }
+        return 0;
+    }
+
+    // Directory (e.g. a dataset) is converted recursively, instances and results are written in binary format,
+    // the other files are copied so that the converted directory stays complete.
+    int numConverted = 0;
+    for (recursive_directory_iterator it(sourcePath); it != recursive_directory_iterator(); it++) {
+        path filePath = it->path();
+        if (!is_regular_file(filePath)) {
+            continue;
+        }
+
+        path fileTargetPath = targetPath / relative(filePath, sourcePath);
+        create_directories(fileTargetPath.parent_path());
+
+        path binaryTargetPath = fileTargetPath;
+        binaryTargetPath.replace_extension(InstanceWriter::BINARY_EXTENSION);
+        if (exists(binaryTargetPath) && equivalent(filePath, binaryTargetPath)) {
+            // Already binary and converted in place.
+            continue;
+        }
+
+        if (convert(filePath, binaryTargetPath)) {
+            numConverted++;
+        }
+        else if (!exists(fileTargetPath) || !equivalent(filePath, fileTargetPath)) {
+            std::ifstream in(filePath.string(), ios::binary);
+            std::ofstream out(fileTargetPath.string(), ios::binary | ios::trunc);
+            out << in.rdbuf();
+        }
+    }
+
+    cout << "Converted " << numConverted << " files." << endl;
+    return 0;
+}
@@ -27,10 +27,10 @@
 #include "../../rseclp/utils/JsonUtils.h"
 #include "../../rseclp/utils/GeneralUtils.h"
 #include "../../rseclp/instance/Instance.h"
-#include "../../rseclp/instance/InstanceJsonWriter.h"
 #include "../../rseclp/solvers/exact/LazyConstraints.h"
 #include "../../rseclp/solvers/heuristics/GreedyHeuristics.h"
 #include "../../rseclp/objectives/TotalTardiness.h"
+#include <iostream>
 #include <random>
 
 namespace rseclp {
@@ -91,7 +91,8 @@ namespace rseclp {
     }
 
     void DatasetGenerator2016B_1::generate(const DatasetGenerator2016B_1::Prescription &p,
-                                           const path &prescriptionOutputDir) const {
+                                           const path &prescriptionOutputDir,
+                                           DatasetOutput &output) const {
         default_random_engine randomEngine;
 
         int lengthMeteringInterval = 15;
@@ -104,6 +105,7 @@ namespace rseclp {
                     for (auto alpha2: p.mAlpha2Vector) {
                         for (auto alpha3: p.mAlpha3Vector) {
                             map<int, path> maxDeviationToInstancesOutputDir;
+                            map<int, int> maxDeviationToRealisationIndex;
 
                             // Generate prescription realisations.
                             for (auto maxDeviation : p.mMaxDeviationVector) {
@@ -111,9 +113,12 @@ namespace rseclp {
                                 create_directory(realisationOutputDir);
 
                                 auto instancesOutputDir = realisationOutputDir / "instances";
-                                create_directory(instancesOutputDir);
+                                if (!output.isArchive()) {
+                                    create_directory(instancesOutputDir);
+                                }
 
                                 maxDeviationToInstancesOutputDir[maxDeviation] = instancesOutputDir;
+                                maxDeviationToRealisationIndex[maxDeviation] = prescriptionRealisationIndex;
 
                                 auto pr = unique_ptr<PrescriptionRealisation>(new PrescriptionRealisation(p.mNumInstances,
                                                                                                           numOperations,
@@ -202,8 +207,10 @@ namespace rseclp {
                                         }
                                     }
 
-                                    auto instancePath = maxDeviationToInstancesOutputDir[maxDeviation] / (to_string(instanceIndex) + ".json");
-                                    InstanceJsonWriter::write(*ins, instancePath.string());
+                                    output.write(*ins,
+                                                 maxDeviationToInstancesOutputDir[maxDeviation],
+                                                 maxDeviationToRealisationIndex[maxDeviation],
+                                                 instanceIndex);
                                 }
                             }
                         }
@@ -228,6 +235,8 @@ namespace rseclp {
         }
         create_directory(prescriptionOutputDir);
 
-        generate(p, prescriptionOutputDir);
+        DatasetOutput output(prescriptionDocument, prescriptionOutputDir);
+        generate(p, prescriptionOutputDir, output);
+        output.close();
     }
 }
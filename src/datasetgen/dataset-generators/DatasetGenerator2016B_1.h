@@ -29,6 +29,7 @@
 #include <boost/filesystem.hpp>
 #include <rapidjson/document.h>
 #include "DatasetGenerator.h"
+#include "DatasetOutput.h"
 #include "../../rseclp/instance/Instance.h"
 
 namespace rseclp {
@@ -80,7 +81,9 @@ namespace rseclp {
                          vector<int> maxDeviationVector);
         };
 
-        void generate(const DatasetGenerator2016B_1::Prescription &p, const path &prescriptionOutputDir) const;
+        void generate(const DatasetGenerator2016B_1::Prescription &p,
+                      const path &prescriptionOutputDir,
+                      DatasetOutput &output) const;
 
     public:
 
@@ -23,11 +23,11 @@
     SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 */
 
+#include <iostream>
 #include "DatasetGenerator2016B_2.h"
 #include "../../rseclp/utils/JsonUtils.h"
 #include "../../rseclp/utils/GeneralUtils.h"
 #include "../../rseclp/instance/Instance.h"
-#include "../../rseclp/instance/InstanceJsonWriter.h"
 #include "../../rseclp/solvers/exact/LazyConstraints.h"
 #include "../../rseclp/solvers/heuristics/GreedyHeuristics.h"
 #include "../../rseclp/objectives/TotalTardiness.h"
@@ -146,19 +146,21 @@ namespace rseclp {
     }
 
     void DatasetGenerator2016B_2::generate(const DatasetGenerator2016B_2::Prescription &p,
-                                           const path &prescriptionOutputDir) const {
+                                           const path &prescriptionOutputDir,
+                                           DatasetOutput &output) const {
         default_random_engine randomEngine;
 
         for (int numOperations: p.mNumOperationsVector) {
             cout << "Generating instances for n=" << numOperations << endl;
             path instancesOutputDir = prescriptionOutputDir / to_string(numOperations);
-            create_directory(instancesOutputDir);
+            if (!output.isArchive()) {
+                create_directory(instancesOutputDir);
+            }
 
             for (int instanceIndex = 0; instanceIndex < p.mNumInstances; instanceIndex++) {
                 cout << "Generating instance " << instanceIndex << endl;
-                auto instancePath = instancesOutputDir / (to_string(instanceIndex) + ".json");
                 auto ins = unique_ptr<Instance>(p.sample(randomEngine, numOperations));
-                InstanceJsonWriter::write(*ins, instancePath.string());
+                output.write(*ins, instancesOutputDir, numOperations, instanceIndex);
             }
         }
     }
@@ -178,6 +180,8 @@ namespace rseclp {
         }
         create_directory(prescriptionOutputDir);
 
-        generate(p, prescriptionOutputDir);
+        DatasetOutput output(prescriptionDocument, prescriptionOutputDir);
+        generate(p, prescriptionOutputDir, output);
+        output.close();
     }
 }
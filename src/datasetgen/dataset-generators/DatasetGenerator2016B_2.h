@@ -30,6 +30,7 @@
 #include <boost/filesystem.hpp>
 #include <rapidjson/document.h>
 #include "DatasetGenerator.h"
+#include "DatasetOutput.h"
 #include "../../rseclp/instance/Instance.h"
 
 namespace rseclp {
@@ -63,7 +64,9 @@ namespace rseclp {
             Instance *sample(default_random_engine &randomEngine, int numOperations) const;
         };
 
-        void generate(const DatasetGenerator2016B_2::Prescription &p, const path &prescriptionOutputDir) const;
+        void generate(const DatasetGenerator2016B_2::Prescription &p,
+                      const path &prescriptionOutputDir,
+                      DatasetOutput &output) const;
 
     public:
 
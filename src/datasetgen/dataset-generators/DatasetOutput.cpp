@@ -0,0 +1,73 @@
+/*
+    
+    Copyright (C) 2017 Czech Technical University in Prague
+    The MIT License (MIT)
+    
+    Permission is hereby granted, free of charge, to any person obtaining
+    a copy of this software and associated documentation files
+    (the "Software"), to deal in the Software without restriction,
+    including without limitation the rights to use, copy, modify, merge,
+    publish, distribute, sublicense, and/or sell copies of the Software,
+    and to permit persons to whom the Software is furnished to do so,
+    subject to the following conditions:
+    
+    The above copyright notice and this permission notice shall be
+    included in all copies or substantial portions of the Software.
+    
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+    EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+    MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+    IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+    CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+    TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+    SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+#include <iostream>
+#include "DatasetOutput.h"
+#include "../../rseclp/instance/InstanceWriter.h"
+
+namespace rseclp {
+    const string DatasetOutput::KEY_INSTANCE_FORMAT = "instanceFormat";
+    const string DatasetOutput::FORMAT_JSON = "json";
+    const string DatasetOutput::FORMAT_BINARY = "binary";
+    const string DatasetOutput::FORMAT_ARCHIVE = "archive";
+
+    DatasetOutput::DatasetOutput(const Document &prescriptionDocument, const path &datasetOutputDir)
+            : mInstanceExtension(".json") {
+        string format = FORMAT_JSON;
+        if (prescriptionDocument.HasMember(KEY_INSTANCE_FORMAT.c_str())) {
+            format = prescriptionDocument[KEY_INSTANCE_FORMAT.c_str()].GetString();
+        }
+
+        if (format == FORMAT_BINARY) {
+            mInstanceExtension = InstanceWriter::BINARY_EXTENSION;
+        }
+        else if (format == FORMAT_ARCHIVE) {
+            mArchive.reset(new DatasetArchiveWriter(datasetOutputDir / DatasetArchiveReader::FILENAME));
+        }
+        else if (format != FORMAT_JSON) {
+            cout << "Invalid instance format " << format << endl;
+            exit(1);
+        }
+    }
+
+    bool DatasetOutput::isArchive() const {
+        return mArchive != nullptr;
+    }
+
+    void DatasetOutput::write(const Instance &ins, const path &instancesOutputDir, int realisationIndex, int repetition) {
+        if (isArchive()) {
+            mArchive->add(realisationIndex, repetition, ins);
+        }
+        else {
+            InstanceWriter::write(ins, instancesOutputDir / (to_string(repetition) + mInstanceExtension));
+        }
+    }
+
+    void DatasetOutput::close() {
+        if (isArchive()) {
+            mArchive->close();
+        }
+    }
+}
@@ -0,0 +1,65 @@
+/*
+    
+    Copyright (C) 2017 Czech Technical University in Prague
+    The MIT License (MIT)
+    
+    Permission is hereby granted, free of charge, to any person obtaining
+    a copy of this software and associated documentation files
+    (the "Software"), to deal in the Software without restriction,
+    including without limitation the rights to use, copy, modify, merge,
+    publish, distribute, sublicense, and/or sell copies of the Software,
+    and to permit persons to whom the Software is furnished to do so,
+    subject to the following conditions:
+    
+    The above copyright notice and this permission notice shall be
+    included in all copies or substantial portions of the Software.
+    
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+    EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+    MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+    IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+    CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+    TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+    SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+#ifndef ROBUSTENERGYAWARESCHEDULING_DATASETOUTPUT_H
+#define ROBUSTENERGYAWARESCHEDULING_DATASETOUTPUT_H
+
+#include <memory>
+#include <string>
+#include <boost/filesystem.hpp>
+#include <rapidjson/document.h>
+#include "../../rseclp/instance/Instance.h"
+#include "../../rseclp/instance/DatasetArchiveWriter.h"
+
+namespace rseclp {
+    using namespace std;
+    using namespace rapidjson;
+    using namespace boost::filesystem;
+
+    // Destination of the generated instances given by the optional prescription field "instanceFormat".
+    // The instances are written either as separate JSON (binary) files or packed into a single dataset archive.
+    class DatasetOutput {
+    public:
+        static const string KEY_INSTANCE_FORMAT;
+        static const string FORMAT_JSON;
+        static const string FORMAT_BINARY;
+        static const string FORMAT_ARCHIVE;
+
+        DatasetOutput(const Document &prescriptionDocument, const path &datasetOutputDir);
+
+        bool isArchive() const;
+
+        // Directory instancesOutputDir is used only if the instances are written as separate files.
+        void write(const Instance &ins, const path &instancesOutputDir, int realisationIndex, int repetition);
+
+        void close();
+
+    private:
+        string mInstanceExtension;
+        unique_ptr<DatasetArchiveWriter> mArchive;
+    };
+}
+
+#endif //ROBUSTENERGYAWARESCHEDULING_DATASETOUTPUT_H
@@ -26,21 +26,24 @@
 #include <boost/filesystem.hpp>
 #include <stdlib.h>
 #include <iostream>
-#include <gurobi_c++.h>
+#include <map>
 #include <mutex>
 #include <thread>
 #include <pthread.h>
 #include <sched.h>
 #include "../rseclp/instance/Instance.h"
-#include "../rseclp/instance/InstanceJsonReader.h"
+#include "../rseclp/instance/InstanceReader.h"
+#include "../rseclp/instance/InstanceWriter.h"
+#include "../rseclp/instance/DatasetArchiveReader.h"
 #include "../rseclp/solvers/MultiStageSolver.h"
 #include "../rseclp/solvers/heuristics/GreedyHeuristics.h"
 #include "../rseclp/solvers/exact/LazyConstraints.h"
 #include "../rseclp/solvers/exact/BranchAndBoundOnOrder.h"
 #include "../rseclp/objectives/TotalTardiness.h"
 #include "../rseclp/feasibility-checkers/FeasibilityChecker.h"
+#include "../rseclp/feasibility-checkers/WorstCaseEnergyEnvelope.h"
 #include "../rseclp/solvers/SolverResultJsonWriter.h"
-#include "../rseclp/solvers/SolverResultJsonReader.h"
+#include "../rseclp/solvers/SolverResultReader.h"
 #include "../rseclp/solvers/heuristics/TabuSearch.h"
 #include "../rseclp/solvers/SolverPrescription.h"
 
@@ -51,8 +54,15 @@ using namespace rseclp;
 struct Work {
     const int mRealisationIndex;
     const int mRepetition;
-
-    Work(int realisationIndex, int repetition) : mRealisationIndex(realisationIndex), mRepetition(repetition) { }
+    const path mInstancePath;
+    // Index of the instance in the dataset archive, -1 if the instance is stored in a separate file.
+    const int mArchiveEntryIndex;
+
+    Work(int realisationIndex, int repetition, const path &instancePath, int archiveEntryIndex = -1)
+            : mRealisationIndex(realisationIndex),
+              mRepetition(repetition),
+              mInstancePath(instancePath),
+              mArchiveEntryIndex(archiveEntryIndex) { }
 };
 
 int main(int argc, char **argv) {
@@ -85,16 +95,41 @@ int main(int argc, char **argv) {
     }
 
     // Generate work.
+    // Packed dataset archive is preferred, otherwise the instances are read from separate files.
+    // If the instance is available in both formats, the binary one is preferred.
+    unique_ptr<DatasetArchiveReader> archive = nullptr;
     vector<Work*> works;
-    for (directory_iterator realisationPathIter(datasetDir); realisationPathIter != directory_iterator(); realisationPathIter++) {
-        path realisationPath = realisationPathIter->path();
-        path instancesDir = realisationPath / "instances";
-        int realisationIndex = stoi(realisationPath.stem().string());
-
-        for (directory_iterator instancesPathIter(instancesDir); instancesPathIter != directory_iterator(); instancesPathIter++) {
-            path instancePath = instancesPathIter->path();
-            int repetition = stoi(instancePath.stem().string());
-            works.push_back(new Work(realisationIndex, repetition));
+    if (exists(datasetDir / DatasetArchiveReader::FILENAME)) {
+        archive.reset(new DatasetArchiveReader(datasetDir / DatasetArchiveReader::FILENAME));
+        for (int entryIndex = 0; entryIndex < archive->getNumEntries(); entryIndex++) {
+            const auto &entry = archive->getEntry(entryIndex);
+            works.push_back(new Work(entry.mRealisationIndex, entry.mRepetition, archive->getArchivePath(), entryIndex));
+        }
+    }
+    else {
+        map<pair<int, int>, path> instancePaths;
+        for (directory_iterator realisationPathIter(datasetDir); realisationPathIter != directory_iterator(); realisationPathIter++) {
+            path realisationPath = realisationPathIter->path();
+            if (!is_directory(realisationPath)) {
+                continue;
+            }
+
+            path instancesDir = realisationPath / "instances";
+            int realisationIndex = stoi(realisationPath.stem().string());
+
+            for (directory_iterator instancesPathIter(instancesDir); instancesPathIter != directory_iterator(); instancesPathIter++) {
+                path instancePath = instancesPathIter->path();
+                int repetition = stoi(instancePath.stem().string());
+                auto key = make_pair(realisationIndex, repetition);
+                auto itInstancePath = instancePaths.find(key);
+                if (itInstancePath == instancePaths.end() || InstanceReader::isPreferred(instancePath, itInstancePath->second)) {
+                    instancePaths[key] = instancePath;
+                }
+            }
+        }
+
+        for (auto &instancePath : instancePaths) {
+            works.push_back(new Work(instancePath.first.first, instancePath.first.second, instancePath.second));
         }
     }
 
@@ -104,15 +139,14 @@ int main(int argc, char **argv) {
     auto threadCallback = [&]() {
         unique_ptr<TotalTardiness> obj(new TotalTardiness());
         while (true) {
-            // This is needed due to license check.
-            mtx.lock();
-            GRBEnv env;
-            mtx.unlock();
-
             unique_ptr<Work> work = nullptr;
             unique_ptr<Instance> ins = nullptr;
             unique_ptr<Solver> solver = nullptr;
             unique_ptr<Solver::Config> cfg = nullptr;
+            unique_ptr<ConvergenceTrace> convergenceTrace = nullptr;
+
+            Telemetry::Registry telemetry(solverPrescription->getTelemetryTimers());
+            Telemetry::Scope telemetryScope(&telemetry);
 
             {
                 // Acquire lock on mtx.
@@ -125,8 +159,13 @@ int main(int argc, char **argv) {
                 work.reset(works.back());
                 works.pop_back();
 
-                path instancePath = datasetDir / to_string(work->mRealisationIndex) / "instances" / (to_string(work->mRepetition) + ".json");
-                ins.reset(InstanceJsonReader::read(instancePath));
+                path instancePath = work->mInstancePath;
+                if (work->mArchiveEntryIndex >= 0) {
+                    ins.reset(archive->read(work->mArchiveEntryIndex));
+                }
+                else {
+                    ins.reset(InstanceReader::read(instancePath));
+                }
 
                 solver.reset(solverPrescription->createSolver(*ins));
 
@@ -135,7 +174,11 @@ int main(int argc, char **argv) {
                 if (solverPrescription->hasPreviousStage()) {
                     path previousStageFilename = path(solverPrescription->getPreviousStage());
                     path previousStageName = previousStageFilename.stem();
-                    auto previousStageResult = SolverResultJsonReader::read(resultsPath / previousStageName / to_string(work->mRealisationIndex) / (to_string(work->mRepetition) + ".json"));
+                    path previousStageResultPath = resultsPath / previousStageName / to_string(work->mRealisationIndex) / (to_string(work->mRepetition) + InstanceWriter::BINARY_EXTENSION);
+                    if (!exists(previousStageResultPath)) {
+                        previousStageResultPath.replace_extension(".json");
+                    }
+                    auto previousStageResult = SolverResultReader::read(previousStageResultPath);
 
                     if (previousStageResult.getStatus() == Solver::Result::Status::OPTIMAL ||
                             previousStageResult.getStatus() == Solver::Result::Status::FEASIBLE) {
@@ -150,16 +193,36 @@ int main(int argc, char **argv) {
                     }
                 }
 
+                if (solverPrescription->getConvergenceTraceCapacity() > 0) {
+                    convergenceTrace.reset(new ConvergenceTrace(solverPrescription->getConvergenceTraceCapacity()));
+                }
+
                 cfg.reset(new Solver::Config(solverPrescription->getConfig().getTimeLimit(),
                                              obj.get(),
                                              useInitStartTimes,
                                              initStartTimes,
-                                             solverPrescription->getConfig().getSpecialisedConfig()));
+                                             solverPrescription->getConfig().getSpecialisedConfig(),
+                                             solverPrescription->getConfig().getFixedOrderEngine(),
+                                             nullptr,
+                                             nullptr,
+                                             convergenceTrace.get()));
+
+                cout << "Starting instance " << instancePath;
+                if (work->mArchiveEntryIndex >= 0) {
+                    cout << " " << work->mRealisationIndex << "/" << work->mRepetition;
+                }
+                cout << endl;
+            }
 
-                cout << "Starting instance " << instancePath << endl;
+            if (convergenceTrace) {
+                convergenceTrace->start();
             }
 
             auto result = solver->solve(*cfg);
+            result.addTelemetry(telemetry.collect());
+            if (convergenceTrace) {
+                result.setConvergenceTrace(convergenceTrace->getEntries());
+            }
 
             {
                 // Acquire lock on mtx.
@@ -167,7 +230,9 @@ int main(int argc, char **argv) {
 
                 if (result.getStatus() == Solver::Result::Status::OPTIMAL ||
                         result.getStatus() == Solver::Result::Status::FEASIBLE) {
-                    if (!FeasibilityChecker(*ins).areFeasible(result.getStartTimes())) {
+                    // Both checkers must accept the solution, so the results over the datasets cross-check them.
+                    if (!FeasibilityChecker(*ins).areFeasible(result.getStartTimes())
+                            || !WorstCaseEnergyEnvelope(*ins).areFeasible(result.getStartTimes())) {
                         cout << "error" << endl;
                         exit(1);
                     }
@@ -23,25 +23,64 @@
     SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 */
 
+#include <cassert>
 #include "FeasibilityChecker.h"
+#include "WorstCaseEnergyEnvelope.h"
+#include "../utils/Telemetry.h"
 
 namespace rseclp {
 
     FeasibilityChecker::FeasibilityChecker(const Instance &ins)
             : mIns(ins),
               mLatestStartTimes(ins.getNumOperations()),
+              mEnergyProfile(ins),
               mUncertaintyScenario(ins.getNumOperations(), 0) {}
 
     bool FeasibilityChecker::areFeasible(const StartTimes &startTimes) {
+        Telemetry::count(Telemetry::FEASIBILITY_CHECKS);
+        bool feasible = computeFeasibility(startTimes);
+        // The envelope assumes a valid baseline schedule, other start times are not cross-checked.
+        assert(!areReleasedAndNonOverlapping(startTimes) || WorstCaseEnergyEnvelope(mIns).areFeasible(startTimes) == feasible);
+        return feasible;
+    }
+
+    bool FeasibilityChecker::areReleasedAndNonOverlapping(const StartTimes &startTimes) const {
+        auto ordered = startTimes.getOperationsOrdered(mIns);
+        for (int position = 0; position < mIns.getNumOperations(); position++) {
+            const Operation &operation = *ordered[position];
+            if (startTimes[operation] < operation.getReleaseTime()) {
+                return false;
+            }
+            if (position > 0 && startTimes[*ordered[position - 1]] + ordered[position - 1]->getProcessingTime() > startTimes[operation]) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    bool FeasibilityChecker::computeFeasibility(const StartTimes &startTimes) {
         StartTimes realisedStartTimes(startTimes);
         auto ordered = startTimes.getOperationsOrdered(mIns);
         startTimes.computeLatestStartTimes(mIns, ordered, mLatestStartTimes);
         fill(mUncertaintyScenario.begin(), mUncertaintyScenario.end(), 0);
         mViolatedMeteringInterval = nullptr;
 
+        mEnergyProfile.clear();
+        for (auto *pOperation : mIns.getOperations()) {
+            mEnergyProfile.insert(*pOperation, realisedStartTimes[*pOperation]);
+        }
+
+        // Only the metering intervals touched by the last shift are checked again.
+        int fromMeteringIntervalIndex = 0;
+        int toMeteringIntervalIndex = mIns.getNumMeteringIntervals() - 1;
+
         int positionArb = 0;
         while (positionArb < mIns.getNumOperations()) {
-            mViolatedMeteringInterval = realisedStartTimes.getViolatedMeteringInterval(mIns);
+            mViolatedMeteringInterval = mEnergyProfile.findViolatedMeteringInterval(fromMeteringIntervalIndex,
+                                                                                    toMeteringIntervalIndex,
+                                                                                    0.1);
+            fromMeteringIntervalIndex = 0;
+            toMeteringIntervalIndex = -1;
             if (mViolatedMeteringInterval != nullptr) {
                 // Reconstruct the uncertainty scenario.
                 for (int position = 0; position < positionArb; position++) {
@@ -59,6 +98,8 @@ namespace rseclp {
                 positionArb += 1;
             }
             else {
+                fromMeteringIntervalIndex = realisedStartTimes[operationArb] / mIns.getLengthMeteringInterval();
+                mEnergyProfile.shift(operationArb, realisedStartTimes[operationArb], realisedStartTimes[operationArb] + 1);
                 realisedStartTimes[operationArb] += 1;
                 int position = positionArb + 1;
                 while (position < mIns.getNumOperations()) {
@@ -68,10 +109,14 @@ namespace rseclp {
                         break;
                     }
                     else {
+                        mEnergyProfile.shift(operation, realisedStartTimes[operation], realisedStartTimes[operation] + 1);
                         realisedStartTimes[operation] += 1;
                         position += 1;
                     }
                 }
+
+                const Operation &lastShiftedOperation = *ordered[position - 1];
+                toMeteringIntervalIndex = (realisedStartTimes[lastShiftedOperation] + lastShiftedOperation.getProcessingTime() - 1) / mIns.getLengthMeteringInterval();
             }
         }
 
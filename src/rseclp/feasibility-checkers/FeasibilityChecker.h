@@ -29,6 +29,7 @@
 #include <algorithm>
 #include "../instance/Instance.h"
 #include "../utils/StartTimes.h"
+#include "../utils/EnergyProfile.h"
 
 namespace rseclp {
     // TODO (refactoring): if we have more checkers, create some interface
@@ -38,6 +39,11 @@ namespace rseclp {
     private:
         const Instance &mIns;
         StartTimes mLatestStartTimes;
+        EnergyProfile mEnergyProfile;
+
+        bool computeFeasibility(const StartTimes &startTimes);
+
+        bool areReleasedAndNonOverlapping(const StartTimes &startTimes) const;
 
     public:
         vector<int> mUncertaintyScenario;
@@ -45,6 +51,7 @@ namespace rseclp {
 
         FeasibilityChecker(const Instance &ins);
 
+        // Debug builds cross-check the result with WorstCaseEnergyEnvelope.
         bool areFeasible(const StartTimes &startTimes);
 
     };
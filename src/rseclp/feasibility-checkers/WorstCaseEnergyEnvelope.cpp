@@ -0,0 +1,223 @@
+/*
+    
+    Copyright (C) 2017 Czech Technical University in Prague
+    The MIT License (MIT)
+    
+    Permission is hereby granted, free of charge, to any person obtaining
+    a copy of this software and associated documentation files
+    (the "Software"), to deal in the Software without restriction,
+    including without limitation the rights to use, copy, modify, merge,
+    publish, distribute, sublicense, and/or sell copies of the Software,
+    and to permit persons to whom the Software is furnished to do so,
+    subject to the following conditions:
+    
+    The above copyright notice and this permission notice shall be
+    included in all copies or substantial portions of the Software.
+    
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+    EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+    MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+    IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+    CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+    TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+    SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+#include <algorithm>
+#include <deque>
+#include <limits>
+#include "WorstCaseEnergyEnvelope.h"
+#include "../utils/GeneralUtils.h"
+
+namespace rseclp {
+
+    WorstCaseEnergyEnvelope::WorstCaseEnergyEnvelope(const Instance &ins)
+            : mIns(ins),
+              mLatestStartTimes(ins.getNumOperations()),
+              mWorstCaseEnergyConsumptions(ins.getNumMeteringIntervals(), 0.0),
+              mValues(ins.getNumOperations()),
+              mPredecessors(ins.getNumOperations()),
+              mUncertaintyScenario(ins.getNumOperations(), 0),
+              mViolatedMeteringInterval(nullptr) {}
+
+    bool WorstCaseEnergyEnvelope::areFeasible(const StartTimes &startTimes) {
+        auto ordered = startTimes.getOperationsOrdered(mIns);
+        startTimes.computeLatestStartTimes(mIns, ordered, mLatestStartTimes);
+        fill(mUncertaintyScenario.begin(), mUncertaintyScenario.end(), 0);
+        mViolatedMeteringInterval = nullptr;
+
+        // Operations that may intersect a metering interval form a range of positions moving right with the interval.
+        int firstPosition = 0;
+        int lastPosition = -1;
+        for (auto *pMeteringInterval : mIns.getMeteringIntervals()) {
+            const MeteringInterval &meteringInterval = *pMeteringInterval;
+
+            while (firstPosition < mIns.getNumOperations()) {
+                const Operation &operation = *ordered[firstPosition];
+                if (mLatestStartTimes[operation] + operation.getProcessingTime() > meteringInterval.getStart()) {
+                    break;
+                }
+                firstPosition++;
+            }
+            lastPosition = max(lastPosition, firstPosition - 1);
+            while (lastPosition + 1 < mIns.getNumOperations()
+                   && startTimes[*ordered[lastPosition + 1]] < meteringInterval.getEnd()) {
+                lastPosition++;
+            }
+
+            if (lastPosition < firstPosition) {
+                mWorstCaseEnergyConsumptions[meteringInterval.getIndex()] = 0.0;
+                continue;
+            }
+
+            int lastRealisedStartTime;
+            double energyConsumption = computeWorstCaseEnergyConsumption(ordered,
+                                                                         startTimes,
+                                                                         firstPosition,
+                                                                         lastPosition,
+                                                                         meteringInterval,
+                                                                         lastRealisedStartTime);
+            mWorstCaseEnergyConsumptions[meteringInterval.getIndex()] = energyConsumption;
+
+            if (mViolatedMeteringInterval == nullptr
+                && GeneralUtils::isGreater(energyConsumption, meteringInterval.getMaxEnergyConsumption(), 0.1)) {
+                mViolatedMeteringInterval = pMeteringInterval;
+                reconstructUncertaintyScenario(ordered, startTimes, firstPosition, lastPosition, lastRealisedStartTime);
+            }
+        }
+
+        return mViolatedMeteringInterval == nullptr;
+    }
+
+    double WorstCaseEnergyEnvelope::computeWorstCaseEnergyConsumption(const vector<const Operation*> &ordered,
+                                                                      const StartTimes &startTimes,
+                                                                      int firstPosition,
+                                                                      int lastPosition,
+                                                                      const MeteringInterval &meteringInterval,
+                                                                      int &lastRealisedStartTime) {
+        const int maxDeviation = mIns.getMaxDeviation();
+        auto energyConsumption = [&](const Operation &operation, int realisedStartTime) {
+            return operation.getPowerConsumption()
+                   * GeneralUtils::computeIntervalsIntersectionLength(meteringInterval.getStart(),
+                                                                      meteringInterval.getEnd(),
+                                                                      realisedStartTime,
+                                                                      realisedStartTime + operation.getProcessingTime());
+        };
+
+        // All realised start times of the first operation are reachable whatever the preceding ones do.
+        {
+            const Operation &operation = *ordered[firstPosition];
+            auto &values = mValues[firstPosition];
+            values.resize(mLatestStartTimes[operation] - startTimes[operation] + 1);
+            for (int realisedStartTime = startTimes[operation]; realisedStartTime <= mLatestStartTimes[operation]; realisedStartTime++) {
+                values[realisedStartTime - startTimes[operation]] = energyConsumption(operation, realisedStartTime);
+            }
+        }
+
+        for (int position = firstPosition + 1; position <= lastPosition; position++) {
+            const Operation &prevOperation = *ordered[position - 1];
+            const Operation &operation = *ordered[position];
+            const int prevStartTime = startTimes[prevOperation];
+            const int startTime = startTimes[operation];
+            const auto &prevValues = mValues[position - 1];
+            auto &values = mValues[position];
+            auto &predecessors = mPredecessors[position];
+            values.resize(mLatestStartTimes[operation] - startTime + 1);
+            predecessors.resize(values.size());
+
+            // Previous operations completing until the baseline start time let the operation start at it, then
+            // it may deviate up to maxDeviation.
+            double idleValue = -numeric_limits<double>::infinity();
+            int idlePredecessor = -1;
+            for (int prevRealisedStartTime = prevStartTime; prevRealisedStartTime + prevOperation.getProcessingTime() <= startTime && prevRealisedStartTime <= mLatestStartTimes[prevOperation]; prevRealisedStartTime++) {
+                if (prevValues[prevRealisedStartTime - prevStartTime] > idleValue) {
+                    idleValue = prevValues[prevRealisedStartTime - prevStartTime];
+                    idlePredecessor = prevRealisedStartTime;
+                }
+            }
+
+            // Otherwise the previous operation completes at max(startTime + 1, realisedStartTime - maxDeviation)
+            // up to realisedStartTime, the window maximum is kept in a monotone deque.
+            deque<int> window;
+            int nextPrevRealisedStartTime = max(prevStartTime, startTime + 1 - prevOperation.getProcessingTime());
+            for (int realisedStartTime = startTime; realisedStartTime <= mLatestStartTimes[operation]; realisedStartTime++) {
+                int windowEnd = min(mLatestStartTimes[prevOperation], realisedStartTime - prevOperation.getProcessingTime());
+                for (; nextPrevRealisedStartTime <= windowEnd; nextPrevRealisedStartTime++) {
+                    double value = prevValues[nextPrevRealisedStartTime - prevStartTime];
+                    while (!window.empty() && prevValues[window.back() - prevStartTime] <= value) {
+                        window.pop_back();
+                    }
+                    window.push_back(nextPrevRealisedStartTime);
+                }
+
+                int windowStart = realisedStartTime - maxDeviation - prevOperation.getProcessingTime();
+                while (!window.empty() && window.front() < windowStart) {
+                    window.pop_front();
+                }
+
+                double bestValue = -numeric_limits<double>::infinity();
+                int bestPredecessor = -1;
+                if (realisedStartTime <= startTime + maxDeviation) {
+                    bestValue = idleValue;
+                    bestPredecessor = idlePredecessor;
+                }
+                if (!window.empty() && prevValues[window.front() - prevStartTime] > bestValue) {
+                    bestValue = prevValues[window.front() - prevStartTime];
+                    bestPredecessor = window.front();
+                }
+
+                values[realisedStartTime - startTime] = bestValue + energyConsumption(operation, realisedStartTime);
+                predecessors[realisedStartTime - startTime] = bestPredecessor;
+            }
+        }
+
+        const Operation &lastOperation = *ordered[lastPosition];
+        const auto &lastValues = mValues[lastPosition];
+        auto itBest = max_element(lastValues.begin(), lastValues.end());
+        lastRealisedStartTime = startTimes[lastOperation] + (int)distance(lastValues.begin(), itBest);
+
+        return *itBest;
+    }
+
+    void WorstCaseEnergyEnvelope::reconstructUncertaintyScenario(const vector<const Operation*> &ordered,
+                                                                 const StartTimes &startTimes,
+                                                                 int firstPosition,
+                                                                 int lastPosition,
+                                                                 int lastRealisedStartTime) {
+        const int maxDeviation = mIns.getMaxDeviation();
+
+        // Realised start times of the intersecting operations by the predecessors.
+        vector<int> realisedStartTimes(lastPosition - firstPosition + 1);
+        realisedStartTimes.back() = lastRealisedStartTime;
+        for (int position = lastPosition; position > firstPosition; position--) {
+            const Operation &operation = *ordered[position];
+            int realisedStartTime = realisedStartTimes[position - firstPosition];
+            realisedStartTimes[position - firstPosition - 1] = mPredecessors[position][realisedStartTime - startTimes[operation]];
+        }
+
+        for (int position = lastPosition; position > firstPosition; position--) {
+            const Operation &operation = *ordered[position];
+            const Operation &prevOperation = *ordered[position - 1];
+            int prevCompletionTime = realisedStartTimes[position - firstPosition - 1] + prevOperation.getProcessingTime();
+            mUncertaintyScenario[operation.getIndex()] = realisedStartTimes[position - firstPosition] - max(startTimes[operation], prevCompletionTime);
+        }
+
+        // The preceding operations deviate as much as needed to push the first intersecting operation to its
+        // realised start time.
+        int realisedStartTime = realisedStartTimes.front();
+        for (int position = firstPosition; position >= 0; position--) {
+            const Operation &operation = *ordered[position];
+            if (realisedStartTime - startTimes[operation] <= maxDeviation) {
+                mUncertaintyScenario[operation.getIndex()] = realisedStartTime - startTimes[operation];
+                break;
+            }
+
+            mUncertaintyScenario[operation.getIndex()] = maxDeviation;
+            realisedStartTime -= maxDeviation + ordered[position - 1]->getProcessingTime();
+        }
+    }
+
+    const vector<double> &WorstCaseEnergyEnvelope::getWorstCaseEnergyConsumptions() const {
+        return mWorstCaseEnergyConsumptions;
+    }
+}
@@ -0,0 +1,79 @@
+/*
+    
+    Copyright (C) 2017 Czech Technical University in Prague
+    The MIT License (MIT)
+    
+    Permission is hereby granted, free of charge, to any person obtaining
+    a copy of this software and associated documentation files
+    (the "Software"), to deal in the Software without restriction,
+    including without limitation the rights to use, copy, modify, merge,
+    publish, distribute, sublicense, and/or sell copies of the Software,
+    and to permit persons to whom the Software is furnished to do so,
+    subject to the following conditions:
+    
+    The above copyright notice and this permission notice shall be
+    included in all copies or substantial portions of the Software.
+    
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+    EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+    MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+    IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+    CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+    TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+    SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+#ifndef ROBUSTENERGYAWARESCHEDULING_WORSTCASEENERGYENVELOPE_H
+#define ROBUSTENERGYAWARESCHEDULING_WORSTCASEENERGYENVELOPE_H
+
+#include "../instance/Instance.h"
+#include "../utils/StartTimes.h"
+
+namespace rseclp {
+
+    // Worst-case energy consumption of every metering interval over all realisations of the baseline start times.
+    // Realised start time of an operation is max(its baseline start time, realised completion time of the previous
+    // operation) plus a deviation from [0, maxDeviation], so the reachable realised start times of an operation form
+    // the interval [baseline start time, latest start time]. For every metering interval, the maximum energy is found
+    // by dynamic programming over the operations that may intersect it, with the realised start time as the state.
+    // The baseline start times are assumed to respect the release times and not to overlap.
+    class WorstCaseEnergyEnvelope {
+    private:
+        const Instance &mIns;
+        StartTimes mLatestStartTimes;
+        vector<double> mWorstCaseEnergyConsumptions;
+
+        // Per position of the order, values and predecessor realised start times indexed by realised start time
+        // minus the baseline start time.
+        vector<vector<double>> mValues;
+        vector<vector<int>> mPredecessors;
+
+        double computeWorstCaseEnergyConsumption(const vector<const Operation*> &ordered,
+                                                 const StartTimes &startTimes,
+                                                 int firstPosition,
+                                                 int lastPosition,
+                                                 const MeteringInterval &meteringInterval,
+                                                 int &lastRealisedStartTime);
+
+        void reconstructUncertaintyScenario(const vector<const Operation*> &ordered,
+                                            const StartTimes &startTimes,
+                                            int firstPosition,
+                                            int lastPosition,
+                                            int lastRealisedStartTime);
+
+    public:
+        vector<int> mUncertaintyScenario;
+        const MeteringInterval *mViolatedMeteringInterval;
+
+        WorstCaseEnergyEnvelope(const Instance &ins);
+
+        // Computes the envelope, on violation also the first violated metering interval and the uncertainty scenario
+        // attaining its worst-case energy consumption.
+        bool areFeasible(const StartTimes &startTimes);
+
+        const vector<double> &getWorstCaseEnergyConsumptions() const;
+    };
+}
+
+
+#endif //ROBUSTENERGYAWARESCHEDULING_WORSTCASEENERGYENVELOPE_H
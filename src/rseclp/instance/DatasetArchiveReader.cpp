@@ -0,0 +1,97 @@
+/*
+    
+    Copyright (C) 2017 Czech Technical University in Prague
+    The MIT License (MIT)
+    
+    Permission is hereby granted, free of charge, to any person obtaining
+    a copy of this software and associated documentation files
+    (the "Software"), to deal in the Software without restriction,
+    including without limitation the rights to use, copy, modify, merge,
+    publish, distribute, sublicense, and/or sell copies of the Software,
+    and to permit persons to whom the Software is furnished to do so,
+    subject to the following conditions:
+    
+    The above copyright notice and this permission notice shall be
+    included in all copies or substantial portions of the Software.
+    
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+    EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+    MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+    IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+    CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+    TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+    SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+#include <cassert>
+#include <sstream>
+#include <stdexcept>
+#include "DatasetArchiveReader.h"
+#include "InstanceBinaryReader.h"
+#include "../utils/BinaryUtils.h"
+
+namespace rseclp {
+
+    static_assert(sizeof(DatasetArchiveReader::Header) == 24, "Unexpected padding of the dataset archive header.");
+    static_assert(sizeof(DatasetArchiveReader::Entry) == 24, "Unexpected padding of the dataset archive entry.");
+
+    const string DatasetArchiveReader::FILENAME = "dataset.bin";
+    const char DatasetArchiveReader::MAGIC[9] = "RSECLPDA";
+    const uint32_t DatasetArchiveReader::VERSION = 1;
+
+    DatasetArchiveReader::DatasetArchiveReader(const path &archivePath)
+            : mArchivePath(archivePath), mFile(archivePath), mEntries(nullptr), mNumEntries(0) {
+        const char *begin = mFile.getData();
+        const char *end = begin + mFile.getSize();
+
+        try {
+            if (!BinaryUtils::hasMagic(begin, mFile.getSize(), MAGIC)) {
+                throw std::invalid_argument("Not a dataset archive.");
+            }
+
+            const char *cursor = begin;
+            auto header = BinaryUtils::readValue<Header>(cursor, end);
+            if (header.mVersion != VERSION) {
+                throw std::invalid_argument("Unsupported version of dataset archive.");
+            }
+
+            if (header.mIndexOffset > mFile.getSize()) {
+                throw std::invalid_argument("Binary data are truncated.");
+            }
+
+            cursor = begin + header.mIndexOffset;
+            mEntries = BinaryUtils::readArray<Entry>(cursor, end, header.mNumEntries);
+            mNumEntries = static_cast<int>(header.mNumEntries);
+
+            for (int entryIndex = 0; entryIndex < mNumEntries; entryIndex++) {
+                const Entry &entry = mEntries[entryIndex];
+                if (entry.mOffset > mFile.getSize() || entry.mSize > mFile.getSize() - entry.mOffset) {
+                    throw std::invalid_argument("Binary data are truncated.");
+                }
+            }
+        }
+        catch (const std::invalid_argument &e) {
+            std::stringstream msg;
+            msg << "Dataset archive '" << archivePath << "' is invalid: " << e.what() << endl;
+            throw std::invalid_argument(msg.str());
+        }
+    }
+
+    const path &DatasetArchiveReader::getArchivePath() const {
+        return mArchivePath;
+    }
+
+    int DatasetArchiveReader::getNumEntries() const {
+        return mNumEntries;
+    }
+
+    const DatasetArchiveReader::Entry &DatasetArchiveReader::getEntry(int entryIndex) const {
+        assert(entryIndex >= 0 && entryIndex < mNumEntries);
+        return mEntries[entryIndex];
+    }
+
+    Instance *DatasetArchiveReader::read(int entryIndex) const {
+        const Entry &entry = getEntry(entryIndex);
+        return InstanceBinaryReader::read(mFile.getData() + entry.mOffset, entry.mSize);
+    }
+}
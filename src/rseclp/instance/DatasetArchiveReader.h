@@ -0,0 +1,80 @@
+/*
+    
+    Copyright (C) 2017 Czech Technical University in Prague
+    The MIT License (MIT)
+    
+    Permission is hereby granted, free of charge, to any person obtaining
+    a copy of this software and associated documentation files
+    (the "Software"), to deal in the Software without restriction,
+    including without limitation the rights to use, copy, modify, merge,
+    publish, distribute, sublicense, and/or sell copies of the Software,
+    and to permit persons to whom the Software is furnished to do so,
+    subject to the following conditions:
+    
+    The above copyright notice and this permission notice shall be
+    included in all copies or substantial portions of the Software.
+    
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+    EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+    MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+    IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+    CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+    TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+    SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+#ifndef ROBUSTENERGYAWARESCHEDULING_DATASETARCHIVEREADER_H
+#define ROBUSTENERGYAWARESCHEDULING_DATASETARCHIVEREADER_H
+
+#include <cstdint>
+#include <boost/filesystem.hpp>
+#include "Instance.h"
+#include "../utils/MappedFile.h"
+
+namespace rseclp {
+
+    using namespace std;
+    using namespace boost::filesystem;
+
+    // Whole dataset packed in a single file: Header, binary instances (see InstanceBinaryReader) aligned to
+    // BinaryUtils::ALIGNMENT, index of numEntries Entry records at indexOffset.
+    class DatasetArchiveReader {
+    public:
+        static const string FILENAME;
+        static const char MAGIC[9];
+        static const uint32_t VERSION;
+
+        struct Header {
+            char mMagic[8];
+            uint32_t mVersion;
+            uint32_t mNumEntries;
+            uint64_t mIndexOffset;
+        };
+
+        struct Entry {
+            int32_t mRealisationIndex;
+            int32_t mRepetition;
+            uint64_t mOffset;
+            uint64_t mSize;
+        };
+
+        explicit DatasetArchiveReader(const path &archivePath);
+
+        const path &getArchivePath() const;
+
+        int getNumEntries() const;
+
+        const Entry &getEntry(int entryIndex) const;
+
+        Instance *read(int entryIndex) const;
+
+    private:
+        const path mArchivePath;
+        MappedFile mFile;
+        const Entry *mEntries;
+        int mNumEntries;
+    };
+}
+
+
+#endif //ROBUSTENERGYAWARESCHEDULING_DATASETARCHIVEREADER_H
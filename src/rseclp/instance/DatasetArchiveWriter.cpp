@@ -0,0 +1,86 @@
+/*
+    
+    Copyright (C) 2017 Czech Technical University in Prague
+    The MIT License (MIT)
+    
+    Permission is hereby granted, free of charge, to any person obtaining
+    a copy of this software and associated documentation files
+    (the "Software"), to deal in the Software without restriction,
+    including without limitation the rights to use, copy, modify, merge,
+    publish, distribute, sublicense, and/or sell copies of the Software,
+    and to permit persons to whom the Software is furnished to do so,
+    subject to the following conditions:
+    
+    The above copyright notice and this permission notice shall be
+    included in all copies or substantial portions of the Software.
+    
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+    EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+    MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+    IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+    CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+    TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+    SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+#include <cstring>
+#include <sstream>
+#include <stdexcept>
+#include "DatasetArchiveWriter.h"
+#include "InstanceBinaryWriter.h"
+#include "../utils/BinaryUtils.h"
+
+namespace rseclp {
+    DatasetArchiveWriter::DatasetArchiveWriter(const path &archivePath)
+            : mOut(archivePath.string(), ios::binary | ios::trunc) {
+        if (!mOut) {
+            std::stringstream msg;
+            msg << "File '" << archivePath << "' cannot be opened for writing." << endl;
+            throw std::invalid_argument(msg.str());
+        }
+
+        // Header is rewritten by close() once the index offset is known.
+        DatasetArchiveReader::Header header;
+        memset(&header, 0, sizeof(header));
+        BinaryUtils::writeValue(mOut, header);
+    }
+
+    DatasetArchiveWriter::~DatasetArchiveWriter() {
+        if (mOut.is_open()) {
+            close();
+        }
+    }
+
+    uint64_t DatasetArchiveWriter::alignOutput() {
+        auto position = static_cast<uint64_t>(mOut.tellp());
+        auto misalignment = position % BinaryUtils::ALIGNMENT;
+        if (misalignment != 0) {
+            BinaryUtils::writePadding(mOut, BinaryUtils::ALIGNMENT - misalignment);
+            position += BinaryUtils::ALIGNMENT - misalignment;
+        }
+        return position;
+    }
+
+    void DatasetArchiveWriter::add(int realisationIndex, int repetition, const Instance &ins) {
+        DatasetArchiveReader::Entry entry;
+        entry.mRealisationIndex = realisationIndex;
+        entry.mRepetition = repetition;
+        entry.mOffset = alignOutput();
+        InstanceBinaryWriter::write(ins, mOut);
+        entry.mSize = static_cast<uint64_t>(mOut.tellp()) - entry.mOffset;
+        mEntries.push_back(entry);
+    }
+
+    void DatasetArchiveWriter::close() {
+        DatasetArchiveReader::Header header;
+        memcpy(header.mMagic, DatasetArchiveReader::MAGIC, sizeof(header.mMagic));
+        header.mVersion = DatasetArchiveReader::VERSION;
+        header.mNumEntries = static_cast<uint32_t>(mEntries.size());
+        header.mIndexOffset = alignOutput();
+
+        BinaryUtils::writeArray(mOut, mEntries.data(), mEntries.size());
+        mOut.seekp(0);
+        BinaryUtils::writeValue(mOut, header);
+        mOut.close();
+    }
+}
@@ -0,0 +1,59 @@
+/*
+    
+    Copyright (C) 2017 Czech Technical University in Prague
+    The MIT License (MIT)
+    
+    Permission is hereby granted, free of charge, to any person obtaining
+    a copy of this software and associated documentation files
+    (the "Software"), to deal in the Software without restriction,
+    including without limitation the rights to use, copy, modify, merge,
+    publish, distribute, sublicense, and/or sell copies of the Software,
+    and to permit persons to whom the Software is furnished to do so,
+    subject to the following conditions:
+    
+    The above copyright notice and this permission notice shall be
+    included in all copies or substantial portions of the Software.
+    
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+    EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+    MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+    IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+    CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+    TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+    SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+#ifndef ROBUSTENERGYAWARESCHEDULING_DATASETARCHIVEWRITER_H
+#define ROBUSTENERGYAWARESCHEDULING_DATASETARCHIVEWRITER_H
+
+#include <fstream>
+#include <vector>
+#include <boost/filesystem.hpp>
+#include "Instance.h"
+#include "DatasetArchiveReader.h"
+
+namespace rseclp {
+    using namespace std;
+    using namespace boost::filesystem;
+
+    // Instances are streamed into the archive as they are added, the index is written by close().
+    class DatasetArchiveWriter {
+    public:
+        explicit DatasetArchiveWriter(const path &archivePath);
+
+        ~DatasetArchiveWriter();
+
+        void add(int realisationIndex, int repetition, const Instance &ins);
+
+        void close();
+
+    private:
+        std::ofstream mOut;
+        vector<DatasetArchiveReader::Entry> mEntries;
+
+        uint64_t alignOutput();
+    };
+}
+
+
+#endif //ROBUSTENERGYAWARESCHEDULING_DATASETARCHIVEWRITER_H
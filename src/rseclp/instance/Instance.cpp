@@ -123,6 +123,33 @@ namespace rseclp {
         assert(lengthMeteringInterval >= 0);
         assert((int) maxEnergyConsumptions.size() == numMeteringIntervals);
 
+        return Instance::create(numOperations,
+                                releaseTimes.data(),
+                                dueDates.data(),
+                                processingTimes.data(),
+                                powerConsumptions.data(),
+                                maxDeviation,
+                                numMeteringIntervals,
+                                lengthMeteringInterval,
+                                maxEnergyConsumptions.data(),
+                                metadata);
+    }
+
+    Instance* Instance::create(const int numOperations,
+                               const int *releaseTimes,
+                               const int *dueDates,
+                               const int *processingTimes,
+                               const double *powerConsumptions,
+                               const int maxDeviation,
+                               const int numMeteringIntervals,
+                               const int lengthMeteringInterval,
+                               const double *maxEnergyConsumptions,
+                               const map<string, string> &metadata) {
+        assert(numOperations >= 0);
+        assert(maxDeviation >= 0);
+        assert(numMeteringIntervals >= 0);
+        assert(lengthMeteringInterval >= 0);
+
         vector<const Operation*> operations;
         for (int operationIndex = 0; operationIndex < numOperations; operationIndex++) {
             operations.push_back(new Operation(operationIndex,
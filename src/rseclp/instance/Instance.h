@@ -103,6 +103,18 @@ namespace rseclp {
                                 const vector<double> maxEnergyConsumptions,
                                 const map<string, string> &metadata);
 
+        // Copies the operations and metering intervals from flat arrays, e.g. viewed in a memory mapped file.
+        static Instance *create(const int numOperations,
+                                const int *releaseTimes,
+                                const int *dueDates,
+                                const int *processingTimes,
+                                const double *powerConsumptions,
+                                const int maxDeviation,
+                                const int numMeteringIntervals,
+                                const int lengthMeteringInterval,
+                                const double *maxEnergyConsumptions,
+                                const map<string, string> &metadata);
+
     };
 
 }
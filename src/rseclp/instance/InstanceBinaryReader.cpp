@@ -0,0 +1,102 @@
+/*
+    
+    Copyright (C) 2017 Czech Technical University in Prague
+    The MIT License (MIT)
+    
+    Permission is hereby granted, free of charge, to any person obtaining
+    a copy of this software and associated documentation files
+    (the "Software"), to deal in the Software without restriction,
+    including without limitation the rights to use, copy, modify, merge,
+    publish, distribute, sublicense, and/or sell copies of the Software,
+    and to permit persons to whom the Software is furnished to do so,
+    subject to the following conditions:
+    
+    The above copyright notice and this permission notice shall be
+    included in all copies or substantial portions of the Software.
+    
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+    EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+    MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+    IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+    CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+    TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+    SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+#include "InstanceBinaryReader.h"
+#include "../utils/BinaryUtils.h"
+#include "../utils/MappedFile.h"
+
+namespace rseclp {
+
+    static_assert(sizeof(int) == sizeof(int32_t), "Binary format requires 32-bit int.");
+    static_assert(sizeof(InstanceBinaryReader::Header) == 32, "Unexpected padding of the binary instance header.");
+
+    const char InstanceBinaryReader::MAGIC[9] = "RSECLPIN";
+    const uint32_t InstanceBinaryReader::VERSION = 1;
+
+    bool InstanceBinaryReader::isBinary(const path &instancePath) {
+        char magic[sizeof(MAGIC) - 1];
+        std::ifstream in(instancePath.string(), ios::binary);
+        in.read(magic, sizeof(magic));
+        return in.gcount() == sizeof(magic) && BinaryUtils::hasMagic(magic, sizeof(magic), MAGIC);
+    }
+
+    bool InstanceBinaryReader::isBinary(const char *data, size_t size) {
+        return BinaryUtils::hasMagic(data, size, MAGIC);
+    }
+
+    Instance *InstanceBinaryReader::read(const path &instancePath) {
+        MappedFile file(instancePath);
+        try {
+            return InstanceBinaryReader::read(file.getData(), file.getSize());
+        }
+        catch (const std::invalid_argument &e) {
+            std::stringstream msg;
+            msg << "Binary instance '" << instancePath << "' is invalid: " << e.what() << endl;
+            throw std::invalid_argument(msg.str());
+        }
+    }
+
+    Instance *InstanceBinaryReader::read(const char *data, size_t size) {
+        if (!isBinary(data, size)) {
+            throw std::invalid_argument("Not a binary instance.");
+        }
+
+        const char *cursor = data;
+        const char *end = data + size;
+
+        auto header = BinaryUtils::readValue<Header>(cursor, end);
+        if (header.mVersion != VERSION) {
+            throw std::invalid_argument("Unsupported version of binary instance.");
+        }
+
+        if (header.mNumOperations < 0 || header.mNumMeteringIntervals < 0) {
+            throw std::invalid_argument("Negative number of operations or metering intervals.");
+        }
+
+        auto numOperations = static_cast<size_t>(header.mNumOperations);
+        auto numMeteringIntervals = static_cast<size_t>(header.mNumMeteringIntervals);
+
+        const double *powerConsumptions = BinaryUtils::readArray<double>(cursor, end, numOperations);
+        const double *maxEnergyConsumptions = BinaryUtils::readArray<double>(cursor, end, numMeteringIntervals);
+        const int32_t *releaseTimes = BinaryUtils::readArray<int32_t>(cursor, end, numOperations);
+        const int32_t *dueDates = BinaryUtils::readArray<int32_t>(cursor, end, numOperations);
+        const int32_t *processingTimes = BinaryUtils::readArray<int32_t>(cursor, end, numOperations);
+        map<string, string> metadata = BinaryUtils::readStringMap(cursor, end, header.mNumMetadata);
+
+        return Instance::create(header.mNumOperations,
+                                releaseTimes,
+                                dueDates,
+                                processingTimes,
+                                powerConsumptions,
+                                header.mMaxDeviation,
+                                header.mNumMeteringIntervals,
+                                header.mLengthMeteringInterval,
+                                maxEnergyConsumptions,
+                                metadata);
+    }
+}
@@ -0,0 +1,67 @@
+/*
+    
+    Copyright (C) 2017 Czech Technical University in Prague
+    The MIT License (MIT)
+    
+    Permission is hereby granted, free of charge, to any person obtaining
+    a copy of this software and associated documentation files
+    (the "Software"), to deal in the Software without restriction,
+    including without limitation the rights to use, copy, modify, merge,
+    publish, distribute, sublicense, and/or sell copies of the Software,
+    and to permit persons to whom the Software is furnished to do so,
+    subject to the following conditions:
+    
+    The above copyright notice and this permission notice shall be
+    included in all copies or substantial portions of the Software.
+    
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+    EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+    MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+    IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+    CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+    TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+    SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+#ifndef ROBUSTENERGYAWARESCHEDULING_INSTANCEBINARYREADER_H
+#define ROBUSTENERGYAWARESCHEDULING_INSTANCEBINARYREADER_H
+
+#include <cstdint>
+#include <boost/filesystem.hpp>
+#include "Instance.h"
+
+namespace rseclp {
+
+    using namespace std;
+    using namespace boost::filesystem;
+
+    // Binary instance layout: Header, powerConsumptions (double[numOperations]),
+    // maxEnergyConsumptions (double[numMeteringIntervals]), releaseTimes, dueDates, processingTimes
+    // (int32[numOperations] each), numMetadata length-prefixed key/value pairs.
+    class InstanceBinaryReader {
+    public:
+        static const char MAGIC[9];
+        static const uint32_t VERSION;
+
+        struct Header {
+            char mMagic[8];
+            uint32_t mVersion;
+            int32_t mNumOperations;
+            int32_t mMaxDeviation;
+            int32_t mNumMeteringIntervals;
+            int32_t mLengthMeteringInterval;
+            uint32_t mNumMetadata;
+        };
+
+        static bool isBinary(const path &instancePath);
+
+        static bool isBinary(const char *data, size_t size);
+
+        static Instance *read(const path &instancePath);
+
+        static Instance *read(const char *data, size_t size);
+    };
+}
+
+
+#endif //ROBUSTENERGYAWARESCHEDULING_INSTANCEBINARYREADER_H
@@ -0,0 +1,69 @@
+/*
+    
+    Copyright (C) 2017 Czech Technical University in Prague
+    The MIT License (MIT)
+    
+    Permission is hereby granted, free of charge, to any person obtaining
+    a copy of this software and associated documentation files
+    (the "Software"), to deal in the Software without restriction,
+    including without limitation the rights to use, copy, modify, merge,
+    publish, distribute, sublicense, and/or sell copies of the Software,
+    and to permit persons to whom the Software is furnished to do so,
+    subject to the following conditions:
+    
+    The above copyright notice and this permission notice shall be
+    included in all copies or substantial portions of the Software.
+    
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+    EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+    MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+    IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+    CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+    TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+    SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+#include <cstring>
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+#include "InstanceBinaryWriter.h"
+#include "InstanceBinaryReader.h"
+#include "../utils/BinaryUtils.h"
+
+namespace rseclp {
+    void InstanceBinaryWriter::write(const Instance &ins, const path &writePath) {
+        std::ofstream out(writePath.string(), ios::binary | ios::trunc);
+        if (!out) {
+            std::stringstream msg;
+            msg << "File '" << writePath << "' cannot be opened for writing." << endl;
+            throw std::invalid_argument(msg.str());
+        }
+        InstanceBinaryWriter::write(ins, out);
+    }
+
+    void InstanceBinaryWriter::write(const Instance &ins, ostream &out) {
+        InstanceBinaryReader::Header header;
+        memcpy(header.mMagic, InstanceBinaryReader::MAGIC, sizeof(header.mMagic));
+        header.mVersion = InstanceBinaryReader::VERSION;
+        header.mNumOperations = ins.getNumOperations();
+        header.mMaxDeviation = ins.getMaxDeviation();
+        header.mNumMeteringIntervals = ins.getNumMeteringIntervals();
+        header.mLengthMeteringInterval = ins.getLengthMeteringInterval();
+        header.mNumMetadata = static_cast<uint32_t>(ins.getMetadata().size());
+        BinaryUtils::writeValue(out, header);
+
+        // Doubles go first, so that every array stays aligned without padding.
+        auto powerConsumptions = ins.collectPowerConsumptions();
+        BinaryUtils::writeArray(out, powerConsumptions.data(), powerConsumptions.size());
+        auto maxEnergyConsumptions = ins.collectMaxEnergyConsumptions();
+        BinaryUtils::writeArray(out, maxEnergyConsumptions.data(), maxEnergyConsumptions.size());
+        auto releaseTimes = ins.collectReleaseTimes();
+        BinaryUtils::writeArray(out, releaseTimes.data(), releaseTimes.size());
+        auto dueDates = ins.collectDueDates();
+        BinaryUtils::writeArray(out, dueDates.data(), dueDates.size());
+        auto processingTimes = ins.collectProcessingTimes();
+        BinaryUtils::writeArray(out, processingTimes.data(), processingTimes.size());
+        BinaryUtils::writeStringMap(out, ins.getMetadata());
+    }
+}
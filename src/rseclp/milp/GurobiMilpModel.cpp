@@ -0,0 +1,261 @@
+/*
+    
+    Copyright (C) 2017 Czech Technical University in Prague
+    The MIT License (MIT)
+    
+    Permission is hereby granted, free of charge, to any person obtaining
+    a copy of this software and associated documentation files
+    (the "Software"), to deal in the Software without restriction,
+    including without limitation the rights to use, copy, modify, merge,
+    publish, distribute, sublicense, and/or sell copies of the Software,
+    and to permit persons to whom the Software is furnished to do so,
+    subject to the following conditions:
+    
+    The above copyright notice and this permission notice shall be
+    included in all copies or substantial portions of the Software.
+    
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+    EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+    MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+    IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+    CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+    TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+    SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+#ifdef RSECLP_WITH_GUROBI
+
+#include "GurobiMilpModel.h"
+
+namespace rseclp {
+
+    GurobiMilpModel::Callback::Callback(GurobiMilpModel &model, MilpCallback &callback)
+            : mModel(model), mCallback(callback) { }
+
+    void GurobiMilpModel::Callback::callback() {
+        if (where == GRB_CB_MIPSOL) {
+            mCallback.onEvent(MilpCallback::Event::SOLUTION, *this);
+        }
+        else if (where == GRB_CB_MIPNODE) {
+            mCallback.onEvent(MilpCallback::Event::NODE, *this);
+        }
+        else {
+            mCallback.onEvent(MilpCallback::Event::POLLING, *this);
+        }
+    }
+
+    vector<double> GurobiMilpModel::Callback::getSolution(const int *vars, const int count) {
+        vector<GRBVar> buffer;
+        double *values = GRBCallback::getSolution(mModel.toGurobiVars(vars, count, buffer), count);
+        vector<double> result(values, values + count);
+        delete[] values;
+        return result;
+    }
+
+    bool GurobiMilpModel::Callback::hasOptimalNodeRelaxation() {
+        return where == GRB_CB_MIPNODE && getIntInfo(GRB_CB_MIPNODE_STATUS) == GRB_OPTIMAL;
+    }
+
+    vector<double> GurobiMilpModel::Callback::getNodeRelaxation(const int *vars, const int count) {
+        vector<GRBVar> buffer;
+        double *values = getNodeRel(mModel.toGurobiVars(vars, count, buffer), count);
+        vector<double> result(values, values + count);
+        delete[] values;
+        return result;
+    }
+
+    double GurobiMilpModel::Callback::getBestObjective() {
+        return getDoubleInfo(GRB_CB_MIPNODE_OBJBST);
+    }
+
+    bool GurobiMilpModel::Callback::hasObjectiveBound() {
+        return where == GRB_CB_MIP || where == GRB_CB_MIPSOL || where == GRB_CB_MIPNODE;
+    }
+
+    double GurobiMilpModel::Callback::getObjectiveBound() {
+        if (where == GRB_CB_MIPSOL) {
+            return getDoubleInfo(GRB_CB_MIPSOL_OBJBND);
+        }
+        if (where == GRB_CB_MIPNODE) {
+            return getDoubleInfo(GRB_CB_MIPNODE_OBJBND);
+        }
+        return getDoubleInfo(GRB_CB_MIP_OBJBND);
+    }
+
+    void GurobiMilpModel::Callback::addLazy(const MilpLinExpr &expr, const MilpSense sense, const double rhs) {
+        GRBCallback::addLazy(mModel.toGurobiExpr(expr), toGurobiSense(sense), rhs);
+    }
+
+    void GurobiMilpModel::Callback::setSolution(const int *vars, const double *values, const int count) {
+        vector<GRBVar> buffer;
+        GRBCallback::setSolution(mModel.toGurobiVars(vars, count, buffer), values, count);
+    }
+
+    void GurobiMilpModel::Callback::useSolution() {
+        GRBCallback::useSolution();
+    }
+
+    void GurobiMilpModel::Callback::abort() {
+        GRBCallback::abort();
+    }
+
+    GurobiMilpModel::GurobiMilpModel(GRBEnv &env) : mModel(env), mPendingUpdate(false) { }
+
+    // Variables added in a single call are usually passed as a slice, which needs no copying.
+    const GRBVar *GurobiMilpModel::toGurobiVars(const int *vars, const int count, vector<GRBVar> &buffer) const {
+        bool consecutive = true;
+        for (int i = 1; i < count && consecutive; i++) {
+            consecutive = vars[i] == vars[0] + i;
+        }
+
+        if (consecutive && count > 0) {
+            return &mVars[vars[0]];
+        }
+
+        buffer.clear();
+        for (int i = 0; i < count; i++) {
+            buffer.push_back(mVars[vars[i]]);
+        }
+        return buffer.data();
+    }
+
+    GRBLinExpr GurobiMilpModel::toGurobiExpr(const MilpLinExpr &expr) const {
+        vector<GRBVar> buffer;
+        GRBLinExpr gurobiExpr = 0;
+        gurobiExpr.addTerms(expr.mCoeffs.data(),
+                            toGurobiVars(expr.mVars.data(), (int)expr.mVars.size(), buffer),
+                            (int)expr.mVars.size());
+        return gurobiExpr;
+    }
+
+    char GurobiMilpModel::toGurobiSense(const MilpSense sense) {
+        switch (sense) {
+            case MilpSense::LESS_EQUAL:
+                return GRB_LESS_EQUAL;
+            case MilpSense::GREATER_EQUAL:
+                return GRB_GREATER_EQUAL;
+            default:
+                return GRB_EQUAL;
+        }
+    }
+
+    void GurobiMilpModel::updateIfPending() {
+        if (mPendingUpdate) {
+            mModel.update();
+            mPendingUpdate = false;
+        }
+    }
+
+    int GurobiMilpModel::addVars(const int count,
+                                 const double lb,
+                                 const double ub,
+                                 const MilpVarType type,
+                                 const vector<string> *names) {
+        int first = (int)mVars.size();
+        if (count <= 0) {
+            return first;
+        }
+
+        char gurobiType = GRB_CONTINUOUS;
+        if (type == MilpVarType::BINARY) {
+            gurobiType = GRB_BINARY;
+        }
+        else if (type == MilpVarType::INTEGER) {
+            gurobiType = GRB_INTEGER;
+        }
+
+        vector<double> lbs((size_t)count, lb);
+        vector<double> ubs((size_t)count, ub >= numeric_limits<double>::max() ? GRB_INFINITY : ub);
+        vector<char> types((size_t)count, gurobiType);
+        GRBVar *vars = mModel.addVars(lbs.data(), ubs.data(), nullptr, types.data(),
+                                      names != nullptr ? names->data() : nullptr, count);
+        mVars.insert(mVars.end(), vars, vars + count);
+        delete[] vars;
+
+        mPendingUpdate = true;
+        return first;
+    }
+
+    void GurobiMilpModel::addConstrs(const vector<MilpLinExpr> &exprs,
+                                     const vector<MilpSense> &senses,
+                                     const vector<double> &rhs) {
+        if (exprs.empty()) {
+            return;
+        }
+
+        vector<GRBLinExpr> gurobiExprs;
+        vector<char> gurobiSenses;
+        for (size_t i = 0; i < exprs.size(); i++) {
+            gurobiExprs.push_back(toGurobiExpr(exprs[i]));
+            gurobiSenses.push_back(toGurobiSense(senses[i]));
+        }
+
+        delete[] mModel.addConstrs(gurobiExprs.data(), gurobiSenses.data(), rhs.data(), nullptr, (int)exprs.size());
+        mPendingUpdate = true;
+    }
+
+    void GurobiMilpModel::addSos1(const int *vars, const double *weights, const int count) {
+        vector<GRBVar> buffer;
+        mModel.addSOS(toGurobiVars(vars, count, buffer), weights, count, GRB_SOS_TYPE1);
+        mPendingUpdate = true;
+    }
+
+    void GurobiMilpModel::setObjective(const MilpLinExpr &expr, const bool minimise) {
+        mModel.setObjective(toGurobiExpr(expr), minimise ? GRB_MINIMIZE : GRB_MAXIMIZE);
+        mPendingUpdate = true;
+    }
+
+    void GurobiMilpModel::setStart(const int var, const double value) {
+        updateIfPending();
+        mVars[var].set(GRB_DoubleAttr_Start, value);
+    }
+
+    void GurobiMilpModel::setTimeLimit(const double seconds) {
+        mModel.getEnv().set(GRB_DoubleParam_TimeLimit, seconds);
+    }
+
+    void GurobiMilpModel::setLazyConstraints(const bool lazyConstraints) {
+        mModel.getEnv().set(GRB_IntParam_LazyConstraints, lazyConstraints ? 1 : 0);
+    }
+
+    void GurobiMilpModel::setCallback(MilpCallback *callback) {
+        mCallback.reset(callback != nullptr ? new Callback(*this, *callback) : nullptr);
+        mModel.setCallback(mCallback.get());
+    }
+
+    MilpStatus GurobiMilpModel::optimize() {
+        updateIfPending();
+        mModel.optimize();
+
+        switch (mModel.get(GRB_IntAttr_Status)) {
+            case GRB_OPTIMAL:
+                return MilpStatus::OPTIMAL;
+            case GRB_INFEASIBLE:
+                return MilpStatus::INFEASIBLE;
+            default:
+                return MilpStatus::INTERRUPTED;
+        }
+    }
+
+    int GurobiMilpModel::getSolutionCount() {
+        return mModel.get(GRB_IntAttr_SolCount);
+    }
+
+    double GurobiMilpModel::getObjectiveValue() {
+        return mModel.get(GRB_DoubleAttr_ObjVal);
+    }
+
+    double GurobiMilpModel::getObjectiveBound() {
+        return mModel.get(GRB_DoubleAttr_ObjBoundC);
+    }
+
+    vector<double> GurobiMilpModel::getValues(const int *vars, const int count) {
+        vector<GRBVar> buffer;
+        double *values = mModel.get(GRB_DoubleAttr_X, toGurobiVars(vars, count, buffer), count);
+        vector<double> result(values, values + count);
+        delete[] values;
+        return result;
+    }
+}
+
+#endif
@@ -0,0 +1,124 @@
+/*
+    
+    Copyright (C) 2017 Czech Technical University in Prague
+    The MIT License (MIT)
+    
+    Permission is hereby granted, free of charge, to any person obtaining
+    a copy of this software and associated documentation files
+    (the "Software"), to deal in the Software without restriction,
+    including without limitation the rights to use, copy, modify, merge,
+    publish, distribute, sublicense, and/or sell copies of the Software,
+    and to permit persons to whom the Software is furnished to do so,
+    subject to the following conditions:
+    
+    The above copyright notice and this permission notice shall be
+    included in all copies or substantial portions of the Software.
+    
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+    EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+    MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+    IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+    CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+    TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+    SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+#ifndef ROBUSTENERGYAWARESCHEDULING_GUROBIMILPMODEL_H
+#define ROBUSTENERGYAWARESCHEDULING_GUROBIMILPMODEL_H
+
+#ifdef RSECLP_WITH_GUROBI
+
+#include <memory>
+#include <gurobi_c++.h>
+#include "MilpModel.h"
+
+namespace rseclp {
+
+    class GurobiMilpModel : public MilpModel {
+    private:
+        class Callback : public GRBCallback, public MilpCallbackContext {
+        private:
+            GurobiMilpModel &mModel;
+            MilpCallback &mCallback;
+
+        public:
+            Callback(GurobiMilpModel &model, MilpCallback &callback);
+
+            virtual vector<double> getSolution(const int *vars, const int count);
+
+            virtual bool hasOptimalNodeRelaxation();
+
+            virtual vector<double> getNodeRelaxation(const int *vars, const int count);
+
+            virtual double getBestObjective();
+
+            virtual bool hasObjectiveBound();
+
+            virtual double getObjectiveBound();
+
+            virtual void addLazy(const MilpLinExpr &expr, const MilpSense sense, const double rhs);
+
+            virtual void setSolution(const int *vars, const double *values, const int count);
+
+            virtual void useSolution();
+
+            virtual void abort();
+
+        protected:
+            virtual void callback();
+        };
+
+        GRBModel mModel;
+        vector<GRBVar> mVars;
+        bool mPendingUpdate;
+        unique_ptr<Callback> mCallback;
+
+        const GRBVar *toGurobiVars(const int *vars, const int count, vector<GRBVar> &buffer) const;
+
+        GRBLinExpr toGurobiExpr(const MilpLinExpr &expr) const;
+
+        static char toGurobiSense(const MilpSense sense);
+
+        void updateIfPending();
+
+    public:
+        GurobiMilpModel(GRBEnv &env);
+
+        virtual int addVars(const int count,
+                            const double lb,
+                            const double ub,
+                            const MilpVarType type,
+                            const vector<string> *names);
+
+        virtual void addConstrs(const vector<MilpLinExpr> &exprs,
+                                const vector<MilpSense> &senses,
+                                const vector<double> &rhs);
+
+        virtual void addSos1(const int *vars, const double *weights, const int count);
+
+        virtual void setObjective(const MilpLinExpr &expr, const bool minimise);
+
+        virtual void setStart(const int var, const double value);
+
+        virtual void setTimeLimit(const double seconds);
+
+        virtual void setLazyConstraints(const bool lazyConstraints);
+
+        virtual void setCallback(MilpCallback *callback);
+
+        virtual MilpStatus optimize();
+
+        virtual int getSolutionCount();
+
+        virtual double getObjectiveValue();
+
+        virtual double getObjectiveBound();
+
+        virtual vector<double> getValues(const int *vars, const int count);
+    };
+}
+
+#endif
+
+
+#endif //ROBUSTENERGYAWARESCHEDULING_GUROBIMILPMODEL_H
@@ -0,0 +1,392 @@
+/*
+    
+    Copyright (C) 2017 Czech Technical University in Prague
+    The MIT License (MIT)
+    
+    Permission is hereby granted, free of charge, to any person obtaining
+    a copy of this software and associated documentation files
+    (the "Software"), to deal in the Software without restriction,
+    including without limitation the rights to use, copy, modify, merge,
+    publish, distribute, sublicense, and/or sell copies of the Software,
+    and to permit persons to whom the Software is furnished to do so,
+    subject to the following conditions:
+    
+    The above copyright notice and this permission notice shall be
+    included in all copies or substantial portions of the Software.
+    
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+    EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+    MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+    IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+    CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+    TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+    SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+#ifdef RSECLP_WITH_HIGHS
+
+#include <algorithm>
+#include <cctype>
+#include <chrono>
+#include <limits>
+#include <stdexcept>
+#include "HighsMilpModel.h"
+
+namespace rseclp {
+
+    HighsMilpModel::Context::Context(HighsMilpModel &model, const double *solution, const double objectiveBound)
+            : mModel(model), mSolution(solution), mObjectiveBound(objectiveBound), mNumLazy(0) { }
+
+    vector<double> HighsMilpModel::Context::getSolution(const int *vars, const int count) {
+        vector<double> result;
+        for (int i = 0; i < count; i++) {
+            result.push_back(mSolution[vars[i]]);
+        }
+        return result;
+    }
+
+    bool HighsMilpModel::Context::hasOptimalNodeRelaxation() {
+        return false;
+    }
+
+    vector<double> HighsMilpModel::Context::getNodeRelaxation(const int */*vars*/, const int /*count*/) {
+        throw invalid_argument("Node relaxations are not available with HiGHS.");
+    }
+
+    double HighsMilpModel::Context::getBestObjective() {
+        if (mModel.mSolution.empty()) {
+            return mModel.mMinimise ? kHighsInf : -kHighsInf;
+        }
+        return mModel.mObjectiveValue;
+    }
+
+    // The bound of a run is valid for the model with all the lazy constraints, which only restrict it further.
+    bool HighsMilpModel::Context::hasObjectiveBound() {
+        return mObjectiveBound > -kHighsInf && mObjectiveBound < kHighsInf;
+    }
+
+    double HighsMilpModel::Context::getObjectiveBound() {
+        return mObjectiveBound;
+    }
+
+    void HighsMilpModel::Context::addLazy(const MilpLinExpr &expr, const MilpSense sense, const double rhs) {
+        mModel.mLazyExprs.push_back(expr);
+        mModel.mLazySenses.push_back(sense);
+        mModel.mLazyRhs.push_back(rhs);
+        mNumLazy++;
+    }
+
+    void HighsMilpModel::Context::setSolution(const int *vars, const double *values, const int count) {
+        for (int i = 0; i < count; i++) {
+            mModel.mStartVars.push_back((HighsInt)vars[i]);
+            mModel.mStartValues.push_back(values[i]);
+        }
+    }
+
+    void HighsMilpModel::Context::useSolution() {
+        // The solution is passed to HiGHS as the start of the next run.
+    }
+
+    void HighsMilpModel::Context::abort() {
+        mModel.mAborted = true;
+    }
+
+    HighsMilpModel::HighsMilpModel(const map<string, string> &params)
+            : mMinimise(true),
+              mTimeLimit(kHighsInf),
+              mLazyConstraints(false),
+              mCallback(nullptr),
+              mAborted(false),
+              mObjectiveValue(0),
+              mObjectiveBound(-kHighsInf) {
+        for (auto &param : params) {
+            setGurobiParam(param.first, param.second);
+        }
+    }
+
+    // Gurobi parameter names are case-insensitive.
+    void HighsMilpModel::setGurobiParam(const string &name, const string &value) {
+        static const map<string, string> highsOptions = {
+                {"threads", "threads"},
+                {"mipgap", "mip_rel_gap"},
+                {"mipgapabs", "mip_abs_gap"},
+                {"logfile", "log_file"},
+                {"seed", "random_seed"}
+        };
+
+        string lowerName(name);
+        transform(lowerName.begin(), lowerName.end(), lowerName.begin(), [](char c) { return (char)tolower(c); });
+        if (lowerName == "outputflag") {
+            mHighs.setOptionValue("output_flag", value != "0");
+        }
+        else if (lowerName == "presolve") {
+            mHighs.setOptionValue("presolve", string(value == "0" ? "off" : value == "-1" ? "choose" : "on"));
+        }
+        else {
+            auto itOption = highsOptions.find(lowerName);
+            if (itOption != highsOptions.end()) {
+                mHighs.setOptionValue(itOption->second, value);
+            }
+        }
+    }
+
+    void HighsMilpModel::addRow(const MilpLinExpr &expr, const MilpSense sense, const double rhs) {
+        mRowVars.clear();
+        for (size_t i = 0; i < expr.mVars.size(); i++) {
+            int var = expr.mVars[i];
+            if (mRowCoeffs[var] == 0.0) {
+                mRowVars.push_back((HighsInt)var);
+            }
+            mRowCoeffs[var] += expr.mCoeffs[i];
+        }
+
+        mRowValues.clear();
+        for (HighsInt var : mRowVars) {
+            mRowValues.push_back(mRowCoeffs[var]);
+            mRowCoeffs[var] = 0.0;
+        }
+
+        double lower = sense == MilpSense::LESS_EQUAL ? -kHighsInf : rhs;
+        double upper = sense == MilpSense::GREATER_EQUAL ? kHighsInf : rhs;
+        mHighs.addRow(lower, upper, (HighsInt)mRowVars.size(), mRowVars.data(), mRowValues.data());
+    }
+
+    void HighsMilpModel::onCallback(const int callbackType,
+                                    const HighsCallbackDataOut *dataOut,
+                                    HighsCallbackDataIn *dataIn) {
+        if (callbackType == kCallbackMipImprovingSolution) {
+            acceptSolution(dataOut->mip_solution, dataOut->mip_dual_bound);
+        }
+        else if (callbackType == kCallbackMipInterrupt) {
+            Context context(*this, nullptr, dataOut->mip_dual_bound);
+            mCallback->onEvent(MilpCallback::Event::POLLING, context);
+            if (mAborted) {
+                dataIn->user_interrupt = 1;
+            }
+        }
+    }
+
+    // The solution is kept only if the callback adds no lazy constraint for it.
+    bool HighsMilpModel::acceptSolution(const double *solution, const double objectiveBound) {
+        vector<double> values(solution, solution + mIsBinary.size());
+        if (mLazyConstraints && mCallback != nullptr) {
+            // A solution is separated only once, its lazy constraints would be added twice otherwise.
+            auto itChecked = mCheckedSolutions.find(values);
+            if (itChecked != mCheckedSolutions.end()) {
+                return itChecked->second;
+            }
+
+            Context context(*this, solution, objectiveBound);
+            mCallback->onEvent(MilpCallback::Event::SOLUTION, context);
+            mCheckedSolutions.emplace(values, context.mNumLazy == 0);
+            if (context.mNumLazy > 0) {
+                return false;
+            }
+        }
+
+        double objectiveValue = 0;
+        for (size_t i = 0; i < mObjective.mVars.size(); i++) {
+            objectiveValue += mObjective.mCoeffs[i] * solution[mObjective.mVars[i]];
+        }
+
+        if (mSolution.empty() || isBetter(objectiveValue, mObjectiveValue)) {
+            mSolution = move(values);
+            mObjectiveValue = objectiveValue;
+        }
+        return true;
+    }
+
+    bool HighsMilpModel::isBetter(const double lhs, const double rhs) const {
+        return mMinimise ? lhs < rhs : lhs > rhs;
+    }
+
+    int HighsMilpModel::addVars(const int count,
+                                const double lb,
+                                const double ub,
+                                const MilpVarType type,
+                                const vector<string> *names) {
+        int first = (int)mIsBinary.size();
+        if (count <= 0) {
+            return first;
+        }
+
+        vector<double> lbs((size_t)count, lb);
+        vector<double> ubs((size_t)count, ub >= numeric_limits<double>::max() ? kHighsInf : ub);
+        mHighs.addVars((HighsInt)count, lbs.data(), ubs.data());
+
+        if (type != MilpVarType::CONTINUOUS) {
+            vector<HighsVarType> integrality((size_t)count, HighsVarType::kInteger);
+            mHighs.changeColsIntegrality((HighsInt)first, (HighsInt)(first + count - 1), integrality.data());
+        }
+
+        if (names != nullptr) {
+            for (int i = 0; i < count; i++) {
+                mHighs.passColName((HighsInt)(first + i), (*names)[i]);
+            }
+        }
+
+        mIsBinary.insert(mIsBinary.end(), (size_t)count, type == MilpVarType::BINARY);
+        mRowCoeffs.resize(mIsBinary.size(), 0.0);
+        return first;
+    }
+
+    void HighsMilpModel::addConstrs(const vector<MilpLinExpr> &exprs,
+                                    const vector<MilpSense> &senses,
+                                    const vector<double> &rhs) {
+        for (size_t i = 0; i < exprs.size(); i++) {
+            addRow(exprs[i], senses[i], rhs[i]);
+        }
+    }
+
+    // HiGHS has no SOS constraints, at most one of the binary variables is non-zero iff their sum is at most one.
+    void HighsMilpModel::addSos1(const int *vars, const double */*weights*/, const int count) {
+        MilpLinExpr expr;
+        for (int i = 0; i < count; i++) {
+            if (!mIsBinary[vars[i]]) {
+                throw invalid_argument("HiGHS supports SOS1 constraints only over binary variables.");
+            }
+            expr.addTerm(vars[i], 1.0);
+        }
+        addRow(expr, MilpSense::LESS_EQUAL, 1.0);
+    }
+
+    void HighsMilpModel::setObjective(const MilpLinExpr &expr, const bool minimise) {
+        for (int var : mObjective.mVars) {
+            mHighs.changeColCost((HighsInt)var, 0.0);
+        }
+
+        // Repeated variables are summed, as in the rows.
+        mObjective.clear();
+        for (size_t i = 0; i < expr.mVars.size(); i++) {
+            int var = expr.mVars[i];
+            if (mRowCoeffs[var] == 0.0) {
+                mObjective.mVars.push_back(var);
+            }
+            mRowCoeffs[var] += expr.mCoeffs[i];
+        }
+        for (int var : mObjective.mVars) {
+            mObjective.mCoeffs.push_back(mRowCoeffs[var]);
+            mHighs.changeColCost((HighsInt)var, mRowCoeffs[var]);
+            mRowCoeffs[var] = 0.0;
+        }
+
+        mMinimise = minimise;
+        mHighs.changeObjectiveSense(minimise ? ObjSense::kMinimize : ObjSense::kMaximize);
+    }
+
+    void HighsMilpModel::setStart(const int var, const double value) {
+        mStartVars.push_back((HighsInt)var);
+        mStartValues.push_back(value);
+    }
+
+    void HighsMilpModel::setTimeLimit(const double seconds) {
+        mTimeLimit = seconds;
+    }
+
+    void HighsMilpModel::setLazyConstraints(const bool lazyConstraints) {
+        mLazyConstraints = lazyConstraints;
+    }
+
+    void HighsMilpModel::setCallback(MilpCallback *callback) {
+        mCallback = callback;
+        if (mCallback != nullptr) {
+            mHighs.setCallback([this](int callbackType,
+                                      const string &/*message*/,
+                                      const HighsCallbackDataOut *dataOut,
+                                      HighsCallbackDataIn *dataIn,
+                                      void */*userData*/) {
+                onCallback(callbackType, dataOut, dataIn);
+            });
+            mHighs.startCallback(kCallbackMipInterrupt);
+            mHighs.startCallback(kCallbackMipImprovingSolution);
+        }
+        else {
+            mHighs.stopCallback(kCallbackMipInterrupt);
+            mHighs.stopCallback(kCallbackMipImprovingSolution);
+        }
+    }
+
+    MilpStatus HighsMilpModel::optimize() {
+        const auto start = chrono::steady_clock::now();
+
+        mAborted = false;
+        mCheckedSolutions.clear();
+        mSolution.clear();
+        mObjectiveBound = mMinimise ? -kHighsInf : kHighsInf;
+
+        MilpStatus status = MilpStatus::INTERRUPTED;
+        while (!mAborted) {
+            double remaining = mTimeLimit - chrono::duration<double>(chrono::steady_clock::now() - start).count();
+            if (remaining <= 0) {
+                break;
+            }
+            mHighs.setOptionValue("time_limit", remaining);
+
+            if (!mStartVars.empty()) {
+                mHighs.setSolution((HighsInt)mStartVars.size(), mStartVars.data(), mStartValues.data());
+                mStartVars.clear();
+                mStartValues.clear();
+            }
+
+            mLazyExprs.clear();
+            mLazySenses.clear();
+            mLazyRhs.clear();
+            mHighs.run();
+
+            HighsModelStatus modelStatus = mHighs.getModelStatus();
+            if (modelStatus == HighsModelStatus::kInfeasible) {
+                // Lazy constraints only restrict the model further.
+                status = mSolution.empty() ? MilpStatus::INFEASIBLE : MilpStatus::INTERRUPTED;
+                break;
+            }
+
+            mObjectiveBound = mHighs.getInfo().mip_dual_bound;
+            bool accepted = mHighs.getInfo().primal_solution_status == kSolutionStatusFeasible
+                            && acceptSolution(mHighs.getSolution().col_value.data(), mObjectiveBound);
+            if (modelStatus != HighsModelStatus::kOptimal) {
+                break;
+            }
+
+            // The optimum of the model with the lazy constraints added so far.
+            if (accepted) {
+                status = MilpStatus::OPTIMAL;
+                mObjectiveBound = mObjectiveValue;
+                break;
+            }
+
+            for (size_t i = 0; i < mLazyExprs.size(); i++) {
+                addRow(mLazyExprs[i], mLazySenses[i], mLazyRhs[i]);
+            }
+
+            if (!mSolution.empty()) {
+                HighsSolution solution;
+                solution.col_value = mSolution;
+                mHighs.setSolution(solution);
+            }
+        }
+
+        return status;
+    }
+
+    int HighsMilpModel::getSolutionCount() {
+        return mSolution.empty() ? 0 : 1;
+    }
+
+    double HighsMilpModel::getObjectiveValue() {
+        return mObjectiveValue;
+    }
+
+    double HighsMilpModel::getObjectiveBound() {
+        return mObjectiveBound;
+    }
+
+    vector<double> HighsMilpModel::getValues(const int *vars, const int count) {
+        vector<double> values;
+        for (int i = 0; i < count; i++) {
+            values.push_back(mSolution[vars[i]]);
+        }
+        return values;
+    }
+}
+
+#endif
@@ -0,0 +1,157 @@
+/*
+    
+    Copyright (C) 2017 Czech Technical University in Prague
+    The MIT License (MIT)
+    
+    Permission is hereby granted, free of charge, to any person obtaining
+    a copy of this software and associated documentation files
+    (the "Software"), to deal in the Software without restriction,
+    including without limitation the rights to use, copy, modify, merge,
+    publish, distribute, sublicense, and/or sell copies of the Software,
+    and to permit persons to whom the Software is furnished to do so,
+    subject to the following conditions:
+    
+    The above copyright notice and this permission notice shall be
+    included in all copies or substantial portions of the Software.
+    
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+    EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+    MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+    IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+    CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+    TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+    SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+#ifndef ROBUSTENERGYAWARESCHEDULING_HIGHSMILPMODEL_H
+#define ROBUSTENERGYAWARESCHEDULING_HIGHSMILPMODEL_H
+
+#ifdef RSECLP_WITH_HIGHS
+
+#include <map>
+#include <Highs.h>
+#include "MilpModel.h"
+
+namespace rseclp {
+
+    // HiGHS cannot add lazy constraints during the search, the model is therefore solved repeatedly: the incumbents
+    // are checked in the callback, their lazy constraints are added after the run and the model is solved again until
+    // the optimal solution satisfies all of them. Node relaxations are not available.
+    class HighsMilpModel : public MilpModel {
+    private:
+        class Context : public MilpCallbackContext {
+        private:
+            HighsMilpModel &mModel;
+            const double *mSolution;
+            const double mObjectiveBound;
+
+        public:
+            int mNumLazy;
+
+            Context(HighsMilpModel &model, const double *solution, const double objectiveBound);
+
+            virtual vector<double> getSolution(const int *vars, const int count);
+
+            virtual bool hasOptimalNodeRelaxation();
+
+            virtual vector<double> getNodeRelaxation(const int *vars, const int count);
+
+            virtual double getBestObjective();
+
+            virtual bool hasObjectiveBound();
+
+            virtual double getObjectiveBound();
+
+            virtual void addLazy(const MilpLinExpr &expr, const MilpSense sense, const double rhs);
+
+            virtual void setSolution(const int *vars, const double *values, const int count);
+
+            virtual void useSolution();
+
+            virtual void abort();
+        };
+
+        Highs mHighs;
+        vector<bool> mIsBinary;
+        MilpLinExpr mObjective;
+        bool mMinimise;
+        double mTimeLimit;
+        bool mLazyConstraints;
+        MilpCallback *mCallback;
+        bool mAborted;
+
+        // Partial solution used as the start of the next run.
+        vector<HighsInt> mStartVars;
+        vector<double> mStartValues;
+
+        // Lazy constraints of the incumbents, added to the model before the next run.
+        vector<MilpLinExpr> mLazyExprs;
+        vector<MilpSense> mLazySenses;
+        vector<double> mLazyRhs;
+
+        // Solutions already given to the callback, whether they were accepted. The final solution of a run was usually
+        // reported as an improving one before.
+        map<vector<double>, bool> mCheckedSolutions;
+
+        // Best solution satisfying the lazy constraints.
+        vector<double> mSolution;
+        double mObjectiveValue;
+        double mObjectiveBound;
+
+        // Coefficients of the row being added, the variables may repeat in the expressions.
+        vector<double> mRowCoeffs;
+        vector<HighsInt> mRowVars;
+        vector<double> mRowValues;
+
+        void setGurobiParam(const string &name, const string &value);
+
+        void addRow(const MilpLinExpr &expr, const MilpSense sense, const double rhs);
+
+        void onCallback(const int callbackType, const HighsCallbackDataOut *dataOut, HighsCallbackDataIn *dataIn);
+
+        bool acceptSolution(const double *solution, const double objectiveBound);
+
+        bool isBetter(const double lhs, const double rhs) const;
+
+    public:
+        // The parameters are named as in Gurobi, only the ones with a HiGHS counterpart are applied.
+        HighsMilpModel(const map<string, string> &params);
+
+        virtual int addVars(const int count,
+                            const double lb,
+                            const double ub,
+                            const MilpVarType type,
+                            const vector<string> *names);
+
+        virtual void addConstrs(const vector<MilpLinExpr> &exprs,
+                                const vector<MilpSense> &senses,
+                                const vector<double> &rhs);
+
+        virtual void addSos1(const int *vars, const double *weights, const int count);
+
+        virtual void setObjective(const MilpLinExpr &expr, const bool minimise);
+
+        virtual void setStart(const int var, const double value);
+
+        virtual void setTimeLimit(const double seconds);
+
+        virtual void setLazyConstraints(const bool lazyConstraints);
+
+        virtual void setCallback(MilpCallback *callback);
+
+        virtual MilpStatus optimize();
+
+        virtual int getSolutionCount();
+
+        virtual double getObjectiveValue();
+
+        virtual double getObjectiveBound();
+
+        virtual vector<double> getValues(const int *vars, const int count);
+    };
+}
+
+#endif
+
+
+#endif //ROBUSTENERGYAWARESCHEDULING_HIGHSMILPMODEL_H
@@ -0,0 +1,74 @@
+/*
+    
+    Copyright (C) 2017 Czech Technical University in Prague
+    The MIT License (MIT)
+    
+    Permission is hereby granted, free of charge, to any person obtaining
+    a copy of this software and associated documentation files
+    (the "Software"), to deal in the Software without restriction,
+    including without limitation the rights to use, copy, modify, merge,
+    publish, distribute, sublicense, and/or sell copies of the Software,
+    and to permit persons to whom the Software is furnished to do so,
+    subject to the following conditions:
+    
+    The above copyright notice and this permission notice shall be
+    included in all copies or substantial portions of the Software.
+    
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+    EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+    MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+    IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+    CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+    TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+    SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+#include <stdexcept>
+#include "MilpEnvironment.h"
+#ifdef RSECLP_WITH_GUROBI
+#include "GurobiMilpModel.h"
+#endif
+#ifdef RSECLP_WITH_HIGHS
+#include "HighsMilpModel.h"
+#endif
+
+namespace rseclp {
+
+    mutex MilpEnvironment::sMutex;
+
+    MilpEnvironment::MilpEnvironment() { }
+
+    MilpEnvironment::~MilpEnvironment() { }
+
+    void MilpEnvironment::setParam(const string &name, const string &value) {
+        mParams[name] = value;
+    }
+
+    bool MilpEnvironment::hasBackend() {
+#if defined(RSECLP_WITH_GUROBI) || defined(RSECLP_WITH_HIGHS)
+        return true;
+#else
+        return false;
+#endif
+    }
+
+    unique_ptr<MilpModel> MilpEnvironment::createModel() {
+#ifdef RSECLP_WITH_GUROBI
+        {
+            lock_guard<mutex> lock(sMutex);
+            if (!mGurobiEnv) {
+                mGurobiEnv.reset(new GRBEnv());
+                for (auto &param : mParams) {
+                    mGurobiEnv->set(param.first, param.second);
+                }
+            }
+        }
+
+        return unique_ptr<MilpModel>(new GurobiMilpModel(*mGurobiEnv));
+#elif defined(RSECLP_WITH_HIGHS)
+        return unique_ptr<MilpModel>(new HighsMilpModel(mParams));
+#else
+        throw invalid_argument("no MILP backend available, build with RSECLP_WITH_GUROBI or RSECLP_WITH_HIGHS");
+#endif
+    }
+}
@@ -0,0 +1,72 @@
+/*
+    
+    Copyright (C) 2017 Czech Technical University in Prague
+    The MIT License (MIT)
+    
+    Permission is hereby granted, free of charge, to any person obtaining
+    a copy of this software and associated documentation files
+    (the "Software"), to deal in the Software without restriction,
+    including without limitation the rights to use, copy, modify, merge,
+    publish, distribute, sublicense, and/or sell copies of the Software,
+    and to permit persons to whom the Software is furnished to do so,
+    subject to the following conditions:
+    
+    The above copyright notice and this permission notice shall be
+    included in all copies or substantial portions of the Software.
+    
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+    EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+    MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+    IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+    CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+    TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+    SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+#ifndef ROBUSTENERGYAWARESCHEDULING_MILPENVIRONMENT_H
+#define ROBUSTENERGYAWARESCHEDULING_MILPENVIRONMENT_H
+
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include "MilpModel.h"
+
+#ifdef RSECLP_WITH_GUROBI
+class GRBEnv;
+#endif
+
+namespace rseclp {
+    using namespace std;
+
+    // Creates the models of the MILP backend the library was built with (options RSECLP_WITH_GUROBI and
+    // RSECLP_WITH_HIGHS), Gurobi is preferred if both are available.
+    class MilpEnvironment {
+    private:
+        // Gurobi parameters given as strings, i.e. gurobiEnvParams of the prescription. HiGHS maps the ones it has a
+        // counterpart for and ignores the others.
+        map<string, string> mParams;
+
+#ifdef RSECLP_WITH_GUROBI
+        // Created on the first model, the license is checked only if some solver needs it.
+        unique_ptr<GRBEnv> mGurobiEnv;
+#endif
+
+        // Backend environments are not created concurrently (license check).
+        static mutex sMutex;
+
+    public:
+        MilpEnvironment();
+
+        ~MilpEnvironment();
+
+        void setParam(const string &name, const string &value);
+
+        static bool hasBackend();
+
+        unique_ptr<MilpModel> createModel();
+    };
+}
+
+
+#endif //ROBUSTENERGYAWARESCHEDULING_MILPENVIRONMENT_H
@@ -0,0 +1,154 @@
+/*
+    
+    Copyright (C) 2017 Czech Technical University in Prague
+    The MIT License (MIT)
+    
+    Permission is hereby granted, free of charge, to any person obtaining
+    a copy of this software and associated documentation files
+    (the "Software"), to deal in the Software without restriction,
+    including without limitation the rights to use, copy, modify, merge,
+    publish, distribute, sublicense, and/or sell copies of the Software,
+    and to permit persons to whom the Software is furnished to do so,
+    subject to the following conditions:
+    
+    The above copyright notice and this permission notice shall be
+    included in all copies or substantial portions of the Software.
+    
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+    EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+    MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+    IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+    CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+    TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+    SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+#ifndef ROBUSTENERGYAWARESCHEDULING_MILPMODEL_H
+#define ROBUSTENERGYAWARESCHEDULING_MILPMODEL_H
+
+#include <string>
+#include <vector>
+
+namespace rseclp {
+    using namespace std;
+
+    // Variables of a model are referred by their indices, variables added in a single call have consecutive indices.
+    class MilpLinExpr {
+    public:
+        vector<int> mVars;
+        vector<double> mCoeffs;
+
+        void addTerm(const int var, const double coeff);
+
+        void addTerms(const int *vars, const double coeff, const int count);
+
+        void clear();
+    };
+
+    enum class MilpVarType {
+        CONTINUOUS,
+        BINARY,
+        INTEGER
+    };
+
+    enum class MilpSense {
+        LESS_EQUAL,
+        GREATER_EQUAL,
+        EQUAL
+    };
+
+    enum class MilpStatus {
+        OPTIMAL,
+        INFEASIBLE,
+        // Stopped by a limit or aborted, solution may exist.
+        INTERRUPTED
+    };
+
+    // Access to the solver state inside the callback, only valid for the duration of the event.
+    class MilpCallbackContext {
+    public:
+        virtual ~MilpCallbackContext() { }
+
+        // Values of the new incumbent candidate in MilpCallback::Event::SOLUTION.
+        virtual vector<double> getSolution(const int *vars, const int count) = 0;
+
+        // Relaxation values in MilpCallback::Event::NODE, only if hasOptimalNodeRelaxation().
+        virtual bool hasOptimalNodeRelaxation() = 0;
+
+        virtual vector<double> getNodeRelaxation(const int *vars, const int count) = 0;
+
+        virtual double getBestObjective() = 0;
+
+        // Bound on the objective of the search so far, only if hasObjectiveBound().
+        virtual bool hasObjectiveBound() = 0;
+
+        virtual double getObjectiveBound() = 0;
+
+        // Rejects the incumbent candidate in MilpCallback::Event::SOLUTION.
+        virtual void addLazy(const MilpLinExpr &expr, const MilpSense sense, const double rhs) = 0;
+
+        // Partial heuristic solution, the remaining variables are completed by the backend.
+        virtual void setSolution(const int *vars, const double *values, const int count) = 0;
+
+        virtual void useSolution() = 0;
+
+        virtual void abort() = 0;
+    };
+
+    class MilpCallback {
+    public:
+        enum class Event {
+            POLLING,
+            NODE,
+            SOLUTION
+        };
+
+        virtual ~MilpCallback() { }
+
+        virtual void onEvent(const Event event, MilpCallbackContext &context) = 0;
+    };
+
+    // Thin layer over a MILP solver, covering only what the ILP based solvers need.
+    class MilpModel {
+    public:
+        virtual ~MilpModel() { }
+
+        // Returns the index of the first added variable, names are optional.
+        virtual int addVars(const int count,
+                            const double lb,
+                            const double ub,
+                            const MilpVarType type,
+                            const vector<string> *names) = 0;
+
+        virtual void addConstrs(const vector<MilpLinExpr> &exprs,
+                                const vector<MilpSense> &senses,
+                                const vector<double> &rhs) = 0;
+
+        // At most one of the variables is non-zero.
+        virtual void addSos1(const int *vars, const double *weights, const int count) = 0;
+
+        virtual void setObjective(const MilpLinExpr &expr, const bool minimise) = 0;
+
+        virtual void setStart(const int var, const double value) = 0;
+
+        virtual void setTimeLimit(const double seconds) = 0;
+
+        // Constraints added in the callback may cut off integer solutions.
+        virtual void setLazyConstraints(const bool lazyConstraints) = 0;
+
+        virtual void setCallback(MilpCallback *callback) = 0;
+
+        virtual MilpStatus optimize() = 0;
+
+        virtual int getSolutionCount() = 0;
+
+        virtual double getObjectiveValue() = 0;
+
+        virtual double getObjectiveBound() = 0;
+
+        virtual vector<double> getValues(const int *vars, const int count) = 0;
+    };
+}
+
+
+#endif //ROBUSTENERGYAWARESCHEDULING_MILPMODEL_H
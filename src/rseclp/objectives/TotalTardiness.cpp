@@ -29,6 +29,7 @@
 #include <functional>
 #include <iostream>
 #include "TotalTardiness.h"
+#include "../utils/Telemetry.h"
 
 namespace rseclp {
 
@@ -73,6 +74,7 @@ namespace rseclp {
                                                 vector<const Operation*> &ordered,
                                                 const StartTimes &startTimes,
                                                 const set<int> remainingOperationIndices) const {
+        Telemetry::ScopedTimer timer(Telemetry::BOUND_TIME);
         // Philippe Baptiste et al. A Branch-and-Bound Procedure to Minimize Total Tardiness on One Machine with Arbitrary Release Dates
         // sect. 3.1 (not primal source)
         int forPosition = ins.getNumOperations() - (int)remainingOperationIndices.size();
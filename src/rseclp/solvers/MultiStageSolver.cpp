@@ -23,13 +23,14 @@
     SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 */
 
+#include <iostream>
 #include "MultiStageSolver.h"
 #include "../utils/Stopwatch.h"
 #include "../feasibility-checkers/FeasibilityChecker.h"
 
 namespace rseclp {
 
-    MultiStageSolver::MultiStageSolver(const Instance &ins, GRBEnv &env) : mIns(ins), mEnv(env) {}
+    MultiStageSolver::MultiStageSolver(const Instance &ins, MilpEnvironment &env) : mIns(ins), mEnv(env) {}
 
     MultiStageSolver::~MultiStageSolver() {
         for (auto solver: mSolvers) {
@@ -82,16 +83,27 @@ namespace rseclp {
                                   cfg.getObjective(),
                                   currentResult.getStatus() == Solver::Result::Status::FEASIBLE,
                                   currentResult.getStartTimes(),
-                                  cfg.getSpecialisedConfig());
-
+                                  cfg.getSpecialisedConfig(),
+                                  cfg.getFixedOrderEngine(),
+                                  cfg.getCancellationFlag(),
+                                  cfg.getIncumbent(),
+                                  cfg.getConvergenceTrace());
+
+            // Each stage is counted separately, the total is the sum of the stages.
+            Telemetry::Registry stageTelemetry(Telemetry::areTimersEnabled());
             Stopwatch stageStopwatch;
             stageStopwatch.start();
-            auto result = solver->solve(newCfg);
+            auto result = [&]() {
+                Telemetry::Scope scope(&stageTelemetry);
+                return solver->solve(newCfg);
+            }();
             stageStopwatch.stop();
+            result.addTelemetry(stageTelemetry.collect());
 
             remainingTime -= stageStopwatch.duration();
 
             MultiStageSolver::mergeOptionalResults(result, currentResult);
+            currentResult.addTelemetry(result.getTelemetry());
             switch (result.getStatus()) {
                 case Solver::Result::Status::FEASIBLE:
                     cout << "Stage " << currentStage << ": " << result.getObjectiveValue() << " (feasible solution)" << endl;
@@ -121,11 +133,23 @@ namespace rseclp {
 
             mSolverResults.push_back(move(result));
 
+            // Next stage starts from the best known solution, even if it was found by another solver.
+            StartTimes incumbentStartTimes;
+            double incumbentObjVal;
+            if (!stop && cfg.testAndGetBetterIncumbent(currentResult.getObjectiveValue(), incumbentStartTimes, incumbentObjVal)) {
+                currentResult.setSolution(Solver::Result::Status::FEASIBLE, incumbentStartTimes, incumbentObjVal);
+            }
+
             if (remainingTime.count() < 0) {
                 cout << "Time out" << endl;
                 stop = true;
             }
 
+            if (cfg.isCancelled()) {
+                cout << "Cancelled" << endl;
+                stop = true;
+            }
+
             if (stop) {
                 break;
             }
@@ -26,8 +26,8 @@
 #ifndef ROBUSTENERGYAWARESCHEDULING_MULTISTAGESOLVER_H
 #define ROBUSTENERGYAWARESCHEDULING_MULTISTAGESOLVER_H
 
-#include <gurobi_c++.h>
 #include "Solver.h"
+#include "../milp/MilpEnvironment.h"
 
 namespace rseclp {
     using namespace std;
@@ -35,7 +35,7 @@ namespace rseclp {
     class MultiStageSolver : public Solver {
     private:
         const Instance &mIns;
-        GRBEnv &mEnv;
+        MilpEnvironment &mEnv;
         vector<Solver*> mSolvers;
         vector<Result> mSolverResults;
 
@@ -43,7 +43,7 @@ namespace rseclp {
 
     public:
 
-        MultiStageSolver(const Instance &ins, GRBEnv &env);
+        MultiStageSolver(const Instance &ins, MilpEnvironment &env);
 
         ~MultiStageSolver();
 
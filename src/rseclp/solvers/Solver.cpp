@@ -81,16 +81,35 @@ namespace rseclp {
         }
     }
 
+    bool Solver::SpecialisedConfig::testAndGetValue(const string &keySolver, const string &key, double &valueOut) const {
+        string stringValue = "";
+        if (testAndGetValue(keySolver, key, stringValue)) {
+            valueOut = stod(stringValue);
+            return true;
+        }
+        else {
+            return false;
+        }
+    }
+
     Solver::Config::Config(chrono::milliseconds timeLimit,
                            const Objective *objective,
                            bool useInitStartTimes,
                            StartTimes initStartTimes,
-                           Solver::SpecialisedConfig specialisedConfig)
+                           Solver::SpecialisedConfig specialisedConfig,
+                           FixedOrderEngine fixedOrderEngine,
+                           atomic<bool> *cancellationFlag,
+                           Solver::Incumbent *incumbent,
+                           ConvergenceTrace *convergenceTrace)
             : mTimeLimit(timeLimit),
               mObjective(objective),
               mUseInitStartTimes(useInitStartTimes),
               mInitStartTimes(move(initStartTimes)),
-              mSpecialisedConfig(move(specialisedConfig)) { }
+              mSpecialisedConfig(move(specialisedConfig)),
+              mFixedOrderEngine(fixedOrderEngine),
+              mCancellationFlag(cancellationFlag),
+              mIncumbent(incumbent),
+              mConvergenceTrace(convergenceTrace) { }
 
     const chrono::milliseconds &Solver::Config::getTimeLimit() const {
         return mTimeLimit;
@@ -112,6 +131,92 @@ namespace rseclp {
         return mSpecialisedConfig;
     }
 
+    FixedOrderEngine Solver::Config::getFixedOrderEngine() const {
+        return mFixedOrderEngine;
+    }
+
+    atomic<bool> *Solver::Config::getCancellationFlag() const {
+        return mCancellationFlag;
+    }
+
+    bool Solver::Config::isCancelled() const {
+        return mCancellationFlag != nullptr && mCancellationFlag->load(memory_order_relaxed);
+    }
+
+    Solver::Incumbent *Solver::Config::getIncumbent() const {
+        return mIncumbent;
+    }
+
+    ConvergenceTrace *Solver::Config::getConvergenceTrace() const {
+        return mConvergenceTrace;
+    }
+
+    bool Solver::Config::publishIncumbent(const StartTimes &startTimes, const double objectiveValue) const {
+        if (mConvergenceTrace != nullptr) {
+            mConvergenceTrace->recordObjectiveValue(*mObjective, objectiveValue);
+        }
+
+        return mIncumbent != nullptr && mIncumbent->publish(*mObjective, startTimes, objectiveValue);
+    }
+
+    void Solver::Config::publishBound(const double bound) const {
+        if (mConvergenceTrace != nullptr) {
+            mConvergenceTrace->recordBound(*mObjective, bound);
+        }
+    }
+
+    double Solver::Config::getIncumbentObjectiveValue() const {
+        return mIncumbent != nullptr ? mIncumbent->getObjectiveValue() : mObjective->worstValue();
+    }
+
+    bool Solver::Config::testAndGetBetterIncumbent(const double objectiveValue,
+                                                   StartTimes &startTimesOut,
+                                                   double &objectiveValueOut) const {
+        if (mIncumbent == nullptr || !mObjective->isBetter(mIncumbent->getObjectiveValue(), objectiveValue)) {
+            return false;
+        }
+
+        return mIncumbent->testAndGet(startTimesOut, objectiveValueOut)
+               && mObjective->isBetter(objectiveValueOut, objectiveValue);
+    }
+
+    Solver::Incumbent::Incumbent(const int numOperations, const double worstObjectiveValue)
+            : mObjectiveValue(worstObjectiveValue),
+              mStartTimes(numOperations),
+              mHasSolution(false) { }
+
+    double Solver::Incumbent::getObjectiveValue() const {
+        return mObjectiveValue.load(memory_order_acquire);
+    }
+
+    bool Solver::Incumbent::testAndGet(StartTimes &startTimesOut, double &objectiveValueOut) const {
+        lock_guard<mutex> lock(mMutex);
+        if (!mHasSolution) {
+            return false;
+        }
+
+        startTimesOut = mStartTimes;
+        objectiveValueOut = mObjectiveValue.load(memory_order_relaxed);
+        return true;
+    }
+
+    bool Solver::Incumbent::publish(const Objective &objective, const StartTimes &startTimes, const double objectiveValue) {
+        // Cheap rejection without locking, most of the published solutions are not improving.
+        if (!objective.isBetter(objectiveValue, getObjectiveValue())) {
+            return false;
+        }
+
+        lock_guard<mutex> lock(mMutex);
+        if (!objective.isBetter(objectiveValue, mObjectiveValue.load(memory_order_relaxed))) {
+            return false;
+        }
+
+        mStartTimes = startTimes;
+        mObjectiveValue.store(objectiveValue, memory_order_release);
+        mHasSolution = true;
+        return true;
+    }
+
     Solver::Result::Result(const int numOperations, const double objectiveValue)
             : mStatus(Solver::Result::Status::NO_SOLUTION),
               mStartTimes(numOperations),
@@ -138,6 +243,10 @@ namespace rseclp {
         mOptional[key] = value;
     }
 
+    void Solver::Result::addTelemetry(const Telemetry &telemetry) {
+        mTelemetry += telemetry;
+    }
+
     Solver::Result::Status Solver::Result::getStatus() const {
         return mStatus;
     }
@@ -158,6 +267,18 @@ namespace rseclp {
         return mOptional;
     }
 
+    const Telemetry &Solver::Result::getTelemetry() const {
+        return mTelemetry;
+    }
+
+    void Solver::Result::setConvergenceTrace(vector<ConvergenceTrace::Entry> convergenceTrace) {
+        mConvergenceTrace = move(convergenceTrace);
+    }
+
+    const vector<ConvergenceTrace::Entry> &Solver::Result::getConvergenceTrace() const {
+        return mConvergenceTrace;
+    }
+
     Solver::Result::Result(Status status,
                            StartTimes startTimes,
                            double objectiveValue,
@@ -30,7 +30,11 @@
 #include <map>
 #include <memory>
 #include <chrono>
+#include <atomic>
+#include <mutex>
 #include "../utils/StartTimes.h"
+#include "../utils/Telemetry.h"
+#include "../utils/ConvergenceTrace.h"
 #include "../objectives/Objective.h"
 
 namespace rseclp {
@@ -41,12 +45,36 @@ namespace rseclp {
         INFEASIBLE = 1
     };
 
+    // Algorithm computing the robust start times for a fixed order, see solvers/fixed-order.
+    enum FixedOrderEngine {
+        FIXED_ORDER_2016B = 0,
+        FIXED_ORDER_OPTIMISED = 1
+    };
+
     class Solver {
     public:
         class Config;
 
         class Status;
 
+        // Best known solution shared by solvers running concurrently, both read and published by them.
+        class Incumbent {
+        private:
+            mutable mutex mMutex;
+            atomic<double> mObjectiveValue;
+            StartTimes mStartTimes;
+            bool mHasSolution;
+
+        public:
+            Incumbent(const int numOperations, const double worstObjectiveValue);
+
+            double getObjectiveValue() const;
+
+            bool testAndGet(StartTimes &startTimesOut, double &objectiveValueOut) const;
+
+            bool publish(const Objective &objective, const StartTimes &startTimes, const double objectiveValue);
+        };
+
         class SpecialisedConfig {
         private:
             map<string, map<string, string>> mSolverToParams;
@@ -64,6 +92,8 @@ namespace rseclp {
 
             int testAndGetValue(const string &keySolver, const string &key, int &valueOut) const;
 
+            bool testAndGetValue(const string &keySolver, const string &key, double &valueOut) const;
+
             template<typename T>
             T getValue(const string &keySolver, const string &key, T defaultValue) const {
                 T value;
@@ -79,13 +109,21 @@ namespace rseclp {
             const bool mUseInitStartTimes;
             const StartTimes mInitStartTimes;
             const SpecialisedConfig mSpecialisedConfig;
+            const FixedOrderEngine mFixedOrderEngine;
+            atomic<bool> *mCancellationFlag;
+            Incumbent *mIncumbent;
+            ConvergenceTrace *mConvergenceTrace;
 
         public:
             Config(chrono::milliseconds timeLimit,
                    const Objective *objective,
                    bool useInitStartTimes,
                    StartTimes initStartTimes,
-                   SpecialisedConfig specialisedConfig);
+                   SpecialisedConfig specialisedConfig,
+                   FixedOrderEngine fixedOrderEngine = FixedOrderEngine::FIXED_ORDER_2016B,
+                   atomic<bool> *cancellationFlag = nullptr,
+                   Incumbent *incumbent = nullptr,
+                   ConvergenceTrace *convergenceTrace = nullptr);
 
             const chrono::milliseconds &getTimeLimit() const;
 
@@ -96,6 +134,30 @@ namespace rseclp {
             const StartTimes &getInitStartTimes() const;
 
             const SpecialisedConfig &getSpecialisedConfig() const;
+
+            FixedOrderEngine getFixedOrderEngine() const;
+
+            atomic<bool> *getCancellationFlag() const;
+
+            bool isCancelled() const;
+
+            Incumbent *getIncumbent() const;
+
+            ConvergenceTrace *getConvergenceTrace() const;
+
+            // Publishes the solution to the incumbent (if any), returns true if it was improved.
+            // The objective value is recorded in the convergence trace (if any) as well.
+            bool publishIncumbent(const StartTimes &startTimes, const double objectiveValue) const;
+
+            // Records the bound on the objective value in the convergence trace (if any).
+            void publishBound(const double bound) const;
+
+            // Objective value of the incumbent or the worst value if there is no incumbent.
+            double getIncumbentObjectiveValue() const;
+
+            bool testAndGetBetterIncumbent(const double objectiveValue,
+                                           StartTimes &startTimesOut,
+                                           double &objectiveValueOut) const;
         };
 
         class Result {
@@ -124,6 +186,9 @@ namespace rseclp {
 
             void setOptional(const string &key, const string &value);
 
+            // Telemetry of the runs is summed, e.g. over the stages of a multi-stage solver.
+            void addTelemetry(const Telemetry &telemetry);
+
             Status getStatus() const;
 
             const StartTimes &getStartTimes() const;
@@ -134,12 +199,20 @@ namespace rseclp {
 
             const map<string, string> &getOptional() const;
 
+            const Telemetry &getTelemetry() const;
+
+            void setConvergenceTrace(vector<ConvergenceTrace::Entry> convergenceTrace);
+
+            const vector<ConvergenceTrace::Entry> &getConvergenceTrace() const;
+
         private:
             Status mStatus;
             StartTimes mStartTimes;
             double mObjectiveValue;
             chrono::milliseconds mSolverRuntime;
             map<string, string> mOptional;
+            Telemetry mTelemetry;
+            vector<ConvergenceTrace::Entry> mConvergenceTrace;
         };
 
     public:
@@ -23,24 +23,35 @@
     SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 */
 
+#include <iostream>
 #include "SolverPrescription.h"
 #include "../utils/JsonUtils.h"
 #include "../objectives/TotalTardiness.h"
 #include "heuristics/GreedyHeuristics.h"
 #include "heuristics/TabuSearch.h"
+#include "heuristics/Grasp.h"
+#include "heuristics/IteratedLocalSearch.h"
+#include "heuristics/LargeNeighbourhoodSearch.h"
+#include "heuristics/BeamSearch.h"
 #include "exact/LazyConstraints.h"
 #include "exact/BranchAndBoundOnOrder.h"
+#include "exact/ConstraintPropagation.h"
+#include "fixed-order/RobustScheduleFixedOrder.h"
 
 namespace rseclp {
     SolverPrescription::SolverPrescription(Solver::Config *config,
                                            const map<string, string> &gurobiEnvParams,
                                            const string &solverStage,
                                            bool hasPreviousStage,
-                                           const string &previousStage)
+                                           const string &previousStage,
+                                           bool telemetryTimers,
+                                           int convergenceTraceCapacity)
             : mConfig(config),
               mSolverStage(solverStage),
               mHasPreviousStage(hasPreviousStage),
-              mPreviousStage(previousStage) {
+              mPreviousStage(previousStage),
+              mTelemetryTimers(telemetryTimers),
+              mConvergenceTraceCapacity(convergenceTraceCapacity) {
         fillGurobiEnvParams(gurobiEnvParams);
     }
 
@@ -80,6 +91,26 @@ namespace rseclp {
             startTimes = StartTimes(JsonUtils::getVector<int>(doc, "initStartTimes"));
         }
 
+        FixedOrderEngine fixedOrderEngine = FixedOrderEngine::FIXED_ORDER_2016B;
+        if (doc.HasMember("fixedOrderEngine")) {
+            fixedOrderEngine = RobustScheduleFixedOrder::engineFromName(doc["fixedOrderEngine"].GetString());
+        }
+
+        bool telemetryTimers = false;
+        if (doc.HasMember("telemetryTimers")) {
+            telemetryTimers = doc["telemetryTimers"].GetBool();
+        }
+
+        // Zero capacity disables the trace.
+        int convergenceTraceCapacity = 0;
+        if (doc.HasMember("convergenceTraceCapacity")) {
+            convergenceTraceCapacity = doc["convergenceTraceCapacity"].GetInt();
+        }
+        unique_ptr<ConvergenceTrace> convergenceTrace;
+        if (convergenceTraceCapacity > 0) {
+            convergenceTrace.reset(new ConvergenceTrace(convergenceTraceCapacity));
+        }
+
         // Solver stage.
         auto const &solverStage = doc["solverStage"];
         const string &solverName = solverStage.FindMember("name")->value.GetString();
@@ -88,12 +119,24 @@ namespace rseclp {
             specialisedConfig.addValue(solverName, string(itCfg->name.GetString()), move(string(itCfg->value.GetString())));
         }
 
-        return new SolverPrescription(
-                new Solver::Config(timeLimit, new TotalTardiness(), useInitStartTimes, startTimes, specialisedConfig),
+        auto solverPrescription = new SolverPrescription(
+                new Solver::Config(timeLimit,
+                                   new TotalTardiness(),
+                                   useInitStartTimes,
+                                   startTimes,
+                                   specialisedConfig,
+                                   fixedOrderEngine,
+                                   nullptr,
+                                   nullptr,
+                                   convergenceTrace.get()),
                 gurobiEnvParams,
                 solverName,
                 hasPreviousStage,
-                previousStage);
+                previousStage,
+                telemetryTimers,
+                convergenceTraceCapacity);
+        solverPrescription->mConvergenceTrace = move(convergenceTrace);
+        return solverPrescription;
     }
 
     const Solver::Config& SolverPrescription::getConfig() const {
@@ -108,15 +151,33 @@ namespace rseclp {
         return mHasPreviousStage;
     }
 
+    bool SolverPrescription::getTelemetryTimers() const {
+        return mTelemetryTimers;
+    }
+
+    int SolverPrescription::getConvergenceTraceCapacity() const {
+        return mConvergenceTraceCapacity;
+    }
+
     Solver* SolverPrescription::createSolver(const Instance &ins) {
         if (mSolverStage == GreedyHeuristics::KEY_SOLVER) {
             return new GreedyHeuristics(ins);
         } else if (mSolverStage == TabuSearch::KEY_SOLVER) {
             return new TabuSearch(ins);
+        } else if (mSolverStage == Grasp::KEY_SOLVER) {
+            return new Grasp(ins);
+        } else if (mSolverStage == IteratedLocalSearch::KEY_SOLVER) {
+            return new IteratedLocalSearch(ins);
+        } else if (mSolverStage == LargeNeighbourhoodSearch::KEY_SOLVER) {
+            return new LargeNeighbourhoodSearch(ins);
+        } else if (mSolverStage == BeamSearch::KEY_SOLVER) {
+            return new BeamSearch(ins);
         } else if (mSolverStage == LazyConstraints::KEY_SOLVER) {
             return new LazyConstraints(ins, mEnv);
         } else if (mSolverStage == BranchAndBoundOnOrder::KEY_SOLVER) {
             return new BranchAndBoundOnOrder(ins);
+        } else if (mSolverStage == ConstraintPropagation::KEY_SOLVER) {
+            return new ConstraintPropagation(ins);
         } else {
             cout << "Unkown solver " << mSolverStage << endl;
             exit(1);
@@ -125,7 +186,7 @@ namespace rseclp {
 
     void SolverPrescription::fillGurobiEnvParams(const map<string, string> &gurobiEnvParams) {
         for (auto &gurobiEnvParam: gurobiEnvParams) {
-            mEnv.set(gurobiEnvParam.first, gurobiEnvParam.second);
+            mEnv.setParam(gurobiEnvParam.first, gurobiEnvParam.second);
         }
     }
 }
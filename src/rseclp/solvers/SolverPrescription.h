@@ -28,18 +28,21 @@
 
 #include <boost/filesystem.hpp>
 #include <rapidjson/document.h>
-#include <gurobi_c++.h>
 #include "Solver.h"
+#include "../milp/MilpEnvironment.h"
 
 namespace rseclp {
 
     class SolverPrescription {
     private:
+        std::unique_ptr<ConvergenceTrace> mConvergenceTrace;
         std::unique_ptr<Solver::Config> mConfig;
-        GRBEnv mEnv;
+        MilpEnvironment mEnv;
         const std::string mSolverStage;
         const bool mHasPreviousStage;
         const std::string mPreviousStage;
+        const bool mTelemetryTimers;
+        const int mConvergenceTraceCapacity;
 
         void fillGurobiEnvParams(const map<string, string> &gurobiEnvParams);
 
@@ -48,13 +51,17 @@ namespace rseclp {
                            const map<string, string> &gurobiEnvParams,
                            const string &solverStage,
                            bool hasPreviousStage,
-                           const string &previousStage);
+                           const string &previousStage,
+                           bool telemetryTimers,
+                           int convergenceTraceCapacity);
 
 
         const Solver::Config &getConfig() const;
         Solver *createSolver(const Instance &ins);
         bool hasPreviousStage() const;
         std::string getPreviousStage() const;
+        bool getTelemetryTimers() const;
+        int getConvergenceTraceCapacity() const;
         static SolverPrescription *read(const boost::filesystem::path &prescriptionPath);
     };
 
@@ -0,0 +1,86 @@
+/*
+    
+    Copyright (C) 2017 Czech Technical University in Prague
+    The MIT License (MIT)
+    
+    Permission is hereby granted, free of charge, to any person obtaining
+    a copy of this software and associated documentation files
+    (the "Software"), to deal in the Software without restriction,
+    including without limitation the rights to use, copy, modify, merge,
+    publish, distribute, sublicense, and/or sell copies of the Software,
+    and to permit persons to whom the Software is furnished to do so,
+    subject to the following conditions:
+    
+    The above copyright notice and this permission notice shall be
+    included in all copies or substantial portions of the Software.
+    
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+    EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+    MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+    IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+    CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+    TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+    SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+#include "SolverResultBinaryReader.h"
+#include "../utils/BinaryUtils.h"
+#include "../utils/MappedFile.h"
+
+namespace rseclp {
+
+    static_assert(sizeof(SolverResultBinaryReader::Header) == 40, "Unexpected padding of the binary result header.");
+
+    const char SolverResultBinaryReader::MAGIC[9] = "RSECLPRE";
+    const uint32_t SolverResultBinaryReader::VERSION = 1;
+
+    bool SolverResultBinaryReader::isBinary(const path &resultPath) {
+        char magic[sizeof(MAGIC) - 1];
+        std::ifstream in(resultPath.string(), ios::binary);
+        in.read(magic, sizeof(magic));
+        return in.gcount() == sizeof(magic) && BinaryUtils::hasMagic(magic, sizeof(magic), MAGIC);
+    }
+
+    Solver::Result SolverResultBinaryReader::read(const path &resultPath) {
+        MappedFile file(resultPath);
+        try {
+            return SolverResultBinaryReader::read(file.getData(), file.getSize());
+        }
+        catch (const std::invalid_argument &e) {
+            std::stringstream msg;
+            msg << "Binary result '" << resultPath << "' is invalid: " << e.what() << endl;
+            throw std::invalid_argument(msg.str());
+        }
+    }
+
+    Solver::Result SolverResultBinaryReader::read(const char *data, size_t size) {
+        if (!BinaryUtils::hasMagic(data, size, MAGIC)) {
+            throw std::invalid_argument("Not a binary result.");
+        }
+
+        const char *cursor = data;
+        const char *end = data + size;
+
+        auto header = BinaryUtils::readValue<Header>(cursor, end);
+        if (header.mVersion != VERSION) {
+            throw std::invalid_argument("Unsupported version of binary result.");
+        }
+
+        if (header.mNumStartTimes < 0) {
+            throw std::invalid_argument("Negative number of start times.");
+        }
+
+        auto numStartTimes = static_cast<size_t>(header.mNumStartTimes);
+        const int32_t *startTimes = BinaryUtils::readArray<int32_t>(cursor, end, numStartTimes);
+        map<string, string> optional = BinaryUtils::readStringMap(cursor, end, header.mNumOptional);
+
+        return Solver::Result(static_cast<Solver::Result::Status>(header.mStatus),
+                              StartTimes(vector<int>(startTimes, startTimes + numStartTimes)),
+                              header.mObjectiveValue,
+                              chrono::milliseconds(header.mSolverRuntimeInMilliseconds),
+                              move(optional));
+    }
+}
@@ -0,0 +1,61 @@
+/*
+    
+    Copyright (C) 2017 Czech Technical University in Prague
+    The MIT License (MIT)
+    
+    Permission is hereby granted, free of charge, to any person obtaining
+    a copy of this software and associated documentation files
+    (the "Software"), to deal in the Software without restriction,
+    including without limitation the rights to use, copy, modify, merge,
+    publish, distribute, sublicense, and/or sell copies of the Software,
+    and to permit persons to whom the Software is furnished to do so,
+    subject to the following conditions:
+    
+    The above copyright notice and this permission notice shall be
+    included in all copies or substantial portions of the Software.
+    
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+    EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+    MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+    IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+    CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+    TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+    SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+#include <cstring>
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+#include "SolverResultBinaryWriter.h"
+#include "SolverResultBinaryReader.h"
+#include "../utils/BinaryUtils.h"
+
+namespace rseclp {
+    void SolverResultBinaryWriter::write(const Solver::Result &result, const path &writePath) {
+        std::ofstream out(writePath.string(), ios::binary | ios::trunc);
+        if (!out) {
+            std::stringstream msg;
+            msg << "File '" << writePath << "' cannot be opened for writing." << endl;
+            throw std::invalid_argument(msg.str());
+        }
+        SolverResultBinaryWriter::write(result, out);
+    }
+
+    void SolverResultBinaryWriter::write(const Solver::Result &result, ostream &out) {
+        const vector<int> &startTimes = result.getStartTimes().getBackingArray();
+
+        SolverResultBinaryReader::Header header;
+        memcpy(header.mMagic, SolverResultBinaryReader::MAGIC, sizeof(header.mMagic));
+        header.mVersion = SolverResultBinaryReader::VERSION;
+        header.mStatus = static_cast<int32_t>(result.getStatus());
+        header.mNumStartTimes = static_cast<int32_t>(startTimes.size());
+        header.mNumOptional = static_cast<uint32_t>(result.getOptional().size());
+        header.mObjectiveValue = result.getObjectiveValue();
+        header.mSolverRuntimeInMilliseconds = static_cast<int64_t>(result.getSolverRuntime().count());
+        BinaryUtils::writeValue(out, header);
+
+        BinaryUtils::writeArray(out, startTimes.data(), startTimes.size());
+        BinaryUtils::writeStringMap(out, result.getOptional());
+    }
+}
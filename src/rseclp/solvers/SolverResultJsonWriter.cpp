@@ -46,6 +46,40 @@ namespace rseclp {
 
         doc.AddMember("optional", optional, doc.GetAllocator());
 
+        Value telemetry;
+        telemetry.SetObject();
+        for (int counter = 0; counter < Telemetry::NUM_COUNTERS; counter++) {
+            auto counterEnum = static_cast<Telemetry::Counter>(counter);
+            telemetry.AddMember(Value(Telemetry::getCounterName(counterEnum).c_str(), doc.GetAllocator()),
+                                Value(static_cast<int64_t>(result.getTelemetry().getCounter(counterEnum))),
+                                doc.GetAllocator());
+        }
+        for (int clock = 0; clock < Telemetry::NUM_CLOCKS; clock++) {
+            auto clockEnum = static_cast<Telemetry::Clock>(clock);
+            telemetry.AddMember(Value(Telemetry::getClockName(clockEnum).c_str(), doc.GetAllocator()),
+                                Value(static_cast<int64_t>(result.getTelemetry().getClock(clockEnum).count())),
+                                doc.GetAllocator());
+        }
+
+        doc.AddMember("telemetry", telemetry, doc.GetAllocator());
+
+        Value convergenceTrace;
+        convergenceTrace.SetArray();
+        for (auto &entry : result.getConvergenceTrace()) {
+            Value item;
+            item.SetObject();
+            item.AddMember("timeInMilliseconds", Value(static_cast<int64_t>(entry.mTime.count())), doc.GetAllocator());
+            if (entry.mHasObjectiveValue) {
+                item.AddMember("objectiveValue", Value(entry.mObjectiveValue), doc.GetAllocator());
+            }
+            if (entry.mHasBound) {
+                item.AddMember("bound", Value(entry.mBound), doc.GetAllocator());
+            }
+            convergenceTrace.PushBack(item, doc.GetAllocator());
+        }
+
+        doc.AddMember("convergenceTrace", convergenceTrace, doc.GetAllocator());
+
         JsonUtils::writeJsonDocument(writePath, doc);
     }
 }
@@ -23,15 +23,17 @@
     SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 */
 
-#include "RobustScheduleFixedOrderDefault.h"
+#include "SolverResultReader.h"
+#include "SolverResultBinaryReader.h"
+#include "SolverResultJsonReader.h"
 
 namespace rseclp {
-
-    RobustScheduleFixedOrderDefault::RobustScheduleFixedOrderDefault(const Instance &ins)
-#ifdef _2016B
-            : RobustScheduleFixedOrder2016B(ins) {}
-#else
-            : RobustScheduleFixedOrderOptimised(ins) {}
-#endif
-
+    Solver::Result SolverResultReader::read(const path &resultPath) {
+        if (SolverResultBinaryReader::isBinary(resultPath)) {
+            return SolverResultBinaryReader::read(resultPath);
+        }
+        else {
+            return SolverResultJsonReader::read(resultPath);
+        }
+    }
 }
@@ -26,16 +26,31 @@
 #include <cassert>
 #include <algorithm>
 #include <iostream>
+#include <stdexcept>
 #include "BranchAndBoundOnOrder.h"
 #include "../../objectives/TotalTardiness.h"
 #include "../../feasibility-checkers/FeasibilityChecker.h"
+#include "../fixed-order/RobustScheduleFixedOrder2016B.h"
+#include "../fixed-order/RobustScheduleFixedOrderOptimised.h"
 
 namespace rseclp {
 
-    BranchAndBoundOnOrder::GlobalState::GlobalState(const Instance &ins, Result result)
+    template <typename Alg>
+    BranchAndBoundOnOrder::GlobalState<Alg>::GlobalState(const Instance &ins, const Solver::Config &cfg, Result result)
             : mAlg(ins),
               mResult(move(result)),
-              mCurrentOrdered(ins.getNumOperations(), nullptr) {
+              mDeadline(cfg.getTimeLimit(), cfg.getCancellationFlag()),
+              mCurrentOrdered(ins.getNumOperations(), nullptr),
+              mWindowEnd(ins.getNumOperations()),
+              mIsFixed(ins.getNumOperations(), false),
+              mLowerBound(cfg.getObjective()->worstValue()),
+              mCheckpoints(ins.getNumOperations()),
+              mOuterLowerBound(cfg.getObjective()->worstValue()),
+              mPublishesBound(false),
+              mPublishedBound(cfg.getObjective()->worstValue()),
+              mNumNodes(0),
+              mNumPrunedNodes(0),
+              mNumInfeasibleNodes(0) {
         mTimeLimitReached = false;
         for (int operationIndex = 0; operationIndex < ins.getNumOperations(); operationIndex++) {
             mRemainingOperationIndices.insert(operationIndex);
@@ -46,16 +61,132 @@ namespace rseclp {
 
     const string BranchAndBoundOnOrder::KEY_SOLVER = "BranchAndBoundOnOrder";
 
+    const long BranchAndBoundOnOrder::NUM_NODES_PER_BOUND = 1024;
+
+    const string BranchAndBoundOnOrder::Config::KEY_NODE_SELECTION = "nodeSelection";
+    const string BranchAndBoundOnOrder::Config::KEY_MAX_OPEN_NODES = "maxOpenNodes";
+
+    const string BranchAndBoundOnOrder::Config::NODE_SELECTION_DFS = "dfs";
+    const string BranchAndBoundOnOrder::Config::NODE_SELECTION_BEST_FIRST = "best_first";
+
+    BranchAndBoundOnOrder::Config::Config(const string nodeSelection, const int maxOpenNodes)
+            : mNodeSelection(nodeSelection), mMaxOpenNodes(maxOpenNodes) {
+        if (mNodeSelection != NODE_SELECTION_DFS && mNodeSelection != NODE_SELECTION_BEST_FIRST) {
+            throw invalid_argument("Unknown node selection '" + mNodeSelection + "'.");
+        }
+    }
+
+    BranchAndBoundOnOrder::Config BranchAndBoundOnOrder::Config::createFrom(const Solver::Config &cfg) {
+        auto &scfg = cfg.getSpecialisedConfig();
+
+        return BranchAndBoundOnOrder::Config(scfg.getValue<string>(KEY_SOLVER, KEY_NODE_SELECTION, NODE_SELECTION_DFS),
+                                             scfg.getValue<int>(KEY_SOLVER, KEY_MAX_OPEN_NODES, 100000));
+    }
+
     Solver::Result BranchAndBoundOnOrder::solve(const Solver::Config &cfg) {
         // TODO (refactoring): Make explicit that this B&B is for total tardiness (in name).
         assert(cfg.getObjective()->getType() == Objective::Type::TOTAL_TARDINESS);
 
-        GlobalState globalState(mIns, Solver::Result(mIns.getNumOperations(), cfg.getObjective()->worstValue()));
+        if (cfg.getFixedOrderEngine() == FixedOrderEngine::FIXED_ORDER_OPTIMISED) {
+            return solveWith<RobustScheduleFixedOrderOptimised>(cfg);
+        }
+
+        return solveWith<RobustScheduleFixedOrder2016B>(cfg);
+    }
+
+    template <typename Alg>
+    Solver::Result BranchAndBoundOnOrder::solveWith(const Solver::Config &cfg) {
+        GlobalState<Alg> globalState(mIns, cfg, Solver::Result(mIns.getNumOperations(), cfg.getObjective()->worstValue()));
+
+        auto scfg = BranchAndBoundOnOrder::Config::createFrom(cfg);
+        const bool isBestFirst = scfg.mNodeSelection == BranchAndBoundOnOrder::Config::NODE_SELECTION_BEST_FIRST;
 
         setInitialSolution(cfg, globalState);
+        globalState.mPublishesBound = true;
+
+        globalState.mStopwatch.start();
+        if (isBestFirst) {
+            inBestFirst(cfg, scfg, globalState);
+        }
+        else {
+            inBranchDfs(cfg, globalState, computeLowerBound(cfg, globalState));
+        }
+        adoptIncumbent(cfg, globalState);
+        if (!globalState.mTimeLimitReached) {
+            if (globalState.mResult.getStatus() == Solver::Result::FEASIBLE) {
+                globalState.mResult.setStatus(Solver::Result::OPTIMAL);
+            }
+            else {
+                globalState.mResult.setStatus(Solver::Result::INFEASIBLE);
+            }
+        }
+        globalState.mStopwatch.stop();
+
+        if (globalState.mResult.getStatus() != Solver::Result::INFEASIBLE) {
+            double upperBound = globalState.mResult.getObjectiveValue();
+            double lowerBound = upperBound;
+            if (globalState.mTimeLimitReached) {
+                lowerBound = min(lowerBound, globalState.mLowerBound);
+            }
+            globalState.mResult.setOptional("lowerBound", to_string(lowerBound));
+            publishBound(cfg, globalState, lowerBound);
+            if (globalState.mResult.getStatus() != Solver::Result::NO_SOLUTION) {
+                double gap = upperBound > 0.0 ? (upperBound - lowerBound) / upperBound : 0.0;
+                globalState.mResult.setOptional("gap", to_string(gap));
+            }
+        }
+
+        auto runtime = globalState.mStopwatch.duration();
+        double nodesPerSecond = runtime.count() > 0 ? 1000.0 * (double)globalState.mNumNodes / (double)runtime.count() : 0.0;
+        globalState.mResult.setOptional("numNodes", to_string(globalState.mNumNodes));
+        globalState.mResult.setOptional("numPrunedNodes", to_string(globalState.mNumPrunedNodes));
+        globalState.mResult.setOptional("numInfeasibleNodes", to_string(globalState.mNumInfeasibleNodes));
+        globalState.mResult.setOptional("nodesPerSecond", to_string(nodesPerSecond));
+        globalState.mResult.setSolverRuntime(runtime);
+
+        return globalState.mResult;
+    }
+
+    Solver::Result BranchAndBoundOnOrder::solveWindow(const Solver::Config &cfg,
+                                                      const vector<const Operation*> &ordered,
+                                                      const int windowStart,
+                                                      const int windowEnd) {
+        assert(cfg.getObjective()->getType() == Objective::Type::TOTAL_TARDINESS);
+        assert(0 <= windowStart && windowStart <= windowEnd && windowEnd <= mIns.getNumOperations());
+
+        if (cfg.getFixedOrderEngine() == FixedOrderEngine::FIXED_ORDER_OPTIMISED) {
+            return solveWindowWith<RobustScheduleFixedOrderOptimised>(cfg, ordered, windowStart, windowEnd);
+        }
+
+        return solveWindowWith<RobustScheduleFixedOrder2016B>(cfg, ordered, windowStart, windowEnd);
+    }
+
+    template <typename Alg>
+    Solver::Result BranchAndBoundOnOrder::solveWindowWith(const Solver::Config &cfg,
+                                                          const vector<const Operation*> &ordered,
+                                                          const int windowStart,
+                                                          const int windowEnd) {
+        // The given order bounds the search, so only the improving orders are found.
+        double objVal = cfg.getObjective()->worstValue();
+        Alg alg(mIns);
+        if (alg.create(ordered) == FeasibilityResult::FEASIBLE) {
+            objVal = cfg.getObjective()->compute(mIns, alg.getStartTimes());
+        }
+
+        GlobalState<Alg> globalState(mIns, cfg, Solver::Result(mIns.getNumOperations(), objVal));
+        globalState.mCurrentOrdered = ordered;
+        globalState.mWindowEnd = windowEnd;
+        for (int position = 0; position < windowStart; position++) {
+            globalState.mRemainingOperationIndices.erase(ordered[position]->getIndex());
+        }
+        for (int position = windowEnd; position < mIns.getNumOperations(); position++) {
+            globalState.mIsFixed[ordered[position]->getIndex()] = true;
+        }
 
         globalState.mStopwatch.start();
-        inBranchDfs(cfg, globalState);
+        if (windowStart == 0 || globalState.mAlg.create(ordered, windowStart - 1) == FeasibilityResult::FEASIBLE) {
+            inBranchDfs(cfg, globalState, computeLowerBound(cfg, globalState));
+        }
         if (!globalState.mTimeLimitReached) {
             if (globalState.mResult.getStatus() == Solver::Result::FEASIBLE) {
                 globalState.mResult.setStatus(Solver::Result::OPTIMAL);
@@ -71,7 +202,8 @@ namespace rseclp {
         return globalState.mResult;
     }
 
-    void BranchAndBoundOnOrder::setInitialSolution(const Solver::Config &cfg, GlobalState &globalState) {
+    template <typename Alg>
+    void BranchAndBoundOnOrder::setInitialSolution(const Solver::Config &cfg, GlobalState<Alg> &globalState) {
         if (cfg.getUseInitStartTimes()) {
             auto &initStartTimes = cfg.getInitStartTimes();
             if (FeasibilityChecker(mIns).areFeasible(initStartTimes)) {
@@ -80,75 +212,278 @@ namespace rseclp {
                                                 cfg.getObjective()->compute(mIns, initStartTimes));
             }
         }
+
+        adoptIncumbent(cfg, globalState);
+    }
+
+    template <typename Alg>
+    void BranchAndBoundOnOrder::adoptIncumbent(const Solver::Config &cfg, GlobalState<Alg> &globalState) {
+        StartTimes incumbentStartTimes;
+        double incumbentObjVal;
+        if (cfg.testAndGetBetterIncumbent(globalState.mResult.getObjectiveValue(), incumbentStartTimes, incumbentObjVal)) {
+            globalState.mResult.setSolution(Solver::Result::FEASIBLE, incumbentStartTimes, incumbentObjVal);
+        }
     }
 
-    void BranchAndBoundOnOrder::inBranchDfs(const Solver::Config &cfg, GlobalState &globalState) {
-        // TODO (optimisation): it would be better to store some partial information regarding lower bound.
+    template <typename Alg>
+    void BranchAndBoundOnOrder::inBranchDfs(const Solver::Config &cfg, GlobalState<Alg> &globalState, const double lowerBound) {
         if (globalState.mTimeLimitReached) {
             return;
         }
 
 
-        if (globalState.mStopwatch.timeLimitReached(cfg.getTimeLimit())) {
+        if (globalState.mDeadline.reached()) {
             globalState.mTimeLimitReached = true;
+            globalState.mLowerBound = computeOpenLowerBound(globalState, lowerBound);
             return;
         }
 
         const TotalTardiness &obj = (const TotalTardiness&) *cfg.getObjective();
-        if (globalState.mRemainingOperationIndices.size() == 0) {
-            // Leaf node.
-            double objVal = obj.compute(mIns, globalState.mAlg.getStartTimes());
-            if (obj.isBetter(objVal, globalState.mResult.getObjectiveValue())) {
-                globalState.mResult.setSolution(Solver::Result::Status::FEASIBLE,
-                                                globalState.mAlg.getStartTimes(),
-                                                objVal);
+        int forPosition = mIns.getNumOperations() - (int)globalState.mRemainingOperationIndices.size();
+        if (forPosition == globalState.mWindowEnd) {
+            // Leaf node, the fixed operations after the window are appended in their order.
+            for (int position = forPosition; position < mIns.getNumOperations(); position++) {
+                if (globalState.mAlg.appendPosition(globalState.mCurrentOrdered, position) == FeasibilityResult::INFEASIBLE) {
+                    return;
+                }
             }
+
+            updateSolution(cfg, globalState);
             return;
         }
 
-        double lowerBound = 0.0;
-
-        double lowerBoundChu = obj.computeLowerBoundChu(mIns,
-                                                        globalState.mCurrentOrdered,
-                                                        globalState.mAlg.getStartTimes(),
-                                                        globalState.mRemainingOperationIndices);
-        lowerBound = max(lowerBound, lowerBoundChu);
+        globalState.mNumNodes++;
+        Telemetry::count(Telemetry::NODES);
+        if (globalState.mPublishesBound && globalState.mNumNodes % NUM_NODES_PER_BOUND == 0) {
+            publishBound(cfg, globalState, computeOpenLowerBound(globalState, lowerBound));
+        }
 
-        if (!obj.isBetter(lowerBound, globalState.mResult.getObjectiveValue())) {
+        // Solutions published by other solvers prune as well, the incumbent is adopted at the end.
+        if (!obj.isBetter(lowerBound, globalState.mResult.getObjectiveValue())
+            || !obj.isBetter(lowerBound, cfg.getIncumbentObjectiveValue())) {
+            globalState.mNumPrunedNodes++;
             return;
         }
 
-        // Branch over all remaining jobs.
-        auto branchOnOrder = vector<int>(globalState.mRemainingOperationIndices.begin(),
-                                         globalState.mRemainingOperationIndices.end());
+        // The children are bounded before the branching, so that the lower bound of the open nodes is known. The engine
+        // state after each child is kept in a checkpoint and restored when the child is searched.
+        vector<pair<int, double>> children;
+        vector<vector<int>> &checkpoints = globalState.mCheckpoints[forPosition];
+        for (int operationIndex : createBranchOnOrder(globalState)) {
+            globalState.mCurrentOrdered[forPosition] = mIns.getOperation(operationIndex);
+            if (globalState.mAlg.appendPosition(globalState.mCurrentOrdered, forPosition) == FeasibilityResult::INFEASIBLE) {
+                globalState.mNumInfeasibleNodes++;
+                continue;
+            }
 
+            double childLowerBound = lowerBound;
+            if (forPosition + 1 < globalState.mWindowEnd) {
+                globalState.mRemainingOperationIndices.erase(operationIndex);
+                childLowerBound = max(lowerBound, obj.computeLowerBoundChu(mIns,
+                                                                           globalState.mCurrentOrdered,
+                                                                           globalState.mAlg.getStartTimes(),
+                                                                           globalState.mRemainingOperationIndices));
+                globalState.mRemainingOperationIndices.insert(operationIndex);
+            }
 
-        // Branching priority.
-        sort(branchOnOrder.begin(), branchOnOrder.end(), [&](const int lhs, const int rhs) {
-            // TODO (refactoring): selectable by specialised config.
-            return mIns.getOperation(lhs)->getDueDate() < mIns.getOperation(rhs)->getDueDate();
-        });
+            if (checkpoints.size() <= children.size()) {
+                checkpoints.emplace_back();
+            }
+            globalState.mAlg.saveCheckpoint(globalState.mCurrentOrdered, forPosition, checkpoints[children.size()]);
+            children.emplace_back(operationIndex, childLowerBound);
+        }
 
-        int forPosition = mIns.getNumOperations() - (int)globalState.mRemainingOperationIndices.size();
-        for (int operationIndex : branchOnOrder) {
-            const Operation *pOperation = mIns.getOperation(operationIndex);
+        vector<double> openLowerBounds(children.size() + 1, cfg.getObjective()->worstValue());
+        for (int child = (int)children.size() - 1; child >= 0; child--) {
+            openLowerBounds[child] = min(openLowerBounds[child + 1], children[child].second);
+        }
+        globalState.mOpenLowerBounds.push_back(move(openLowerBounds));
+        globalState.mNextChildren.push_back(0);
 
-            globalState.mCurrentOrdered[forPosition] = pOperation;
-            globalState.mRemainingOperationIndices.erase(operationIndex);
+        for (int child = 0; child < (int)children.size(); child++) {
+            globalState.mNextChildren.back() = child + 1;
 
-            if (globalState.mAlg.appendPosition(globalState.mCurrentOrdered, forPosition) == FeasibilityResult::FEASIBLE) {
-                // Go deeper.
-                inBranchDfs(cfg, globalState);
-            } else {
-                // Infeasible.
-                // TODO (optimisation): question is, could I stop searching in this subtree?
+            int operationIndex = children[child].first;
+            double childLowerBound = children[child].second;
+            if (!obj.isBetter(childLowerBound, globalState.mResult.getObjectiveValue())
+                || !obj.isBetter(childLowerBound, cfg.getIncumbentObjectiveValue())) {
+                globalState.mNumPrunedNodes++;
+                continue;
             }
 
+            globalState.mCurrentOrdered[forPosition] = mIns.getOperation(operationIndex);
+            globalState.mRemainingOperationIndices.erase(operationIndex);
+
+            // Go deeper.
+            globalState.mAlg.restoreCheckpoint(globalState.mCurrentOrdered, forPosition, checkpoints[child]);
+            inBranchDfs(cfg, globalState, childLowerBound);
+
             globalState.mRemainingOperationIndices.insert(operationIndex);
 
             if (globalState.mTimeLimitReached) {
+                break;
+            }
+        }
+
+        globalState.mOpenLowerBounds.pop_back();
+        globalState.mNextChildren.pop_back();
+    }
+
+    template <typename Alg>
+    double BranchAndBoundOnOrder::computeLowerBound(const Solver::Config &cfg, GlobalState<Alg> &globalState) const {
+        const TotalTardiness &obj = (const TotalTardiness&) *cfg.getObjective();
+        return obj.computeLowerBoundChu(mIns,
+                                        globalState.mCurrentOrdered,
+                                        globalState.mAlg.getStartTimes(),
+                                        globalState.mRemainingOperationIndices);
+    }
+
+    template <typename Alg>
+    double BranchAndBoundOnOrder::computeOpenLowerBound(const GlobalState<Alg> &globalState, const double lowerBound) const {
+        // The open nodes are the current node, the children not yet searched on the levels above it and the nodes
+        // outside the depth-first search.
+        double openLowerBound = min(lowerBound, globalState.mOuterLowerBound);
+        for (int level = 0; level < (int)globalState.mOpenLowerBounds.size(); level++) {
+            openLowerBound = min(openLowerBound, globalState.mOpenLowerBounds[level][globalState.mNextChildren[level]]);
+        }
+
+        return openLowerBound;
+    }
+
+    // Publishing locks the convergence trace, so an unchanged bound is not published again.
+    template <typename Alg>
+    void BranchAndBoundOnOrder::publishBound(const Solver::Config &cfg,
+                                             GlobalState<Alg> &globalState,
+                                             const double bound) const {
+        if (globalState.mPublishesBound && bound != globalState.mPublishedBound) {
+            globalState.mPublishedBound = bound;
+            cfg.publishBound(bound);
+        }
+    }
+
+    template <typename Alg>
+    void BranchAndBoundOnOrder::inBestFirst(const Solver::Config &cfg,
+                                            const BranchAndBoundOnOrder::Config &scfg,
+                                            GlobalState<Alg> &globalState) {
+        const TotalTardiness &obj = (const TotalTardiness&) *cfg.getObjective();
+        const int numOperations = mIns.getNumOperations();
+
+        // The heap top is the node with the least lower bound, the deeper one on ties.
+        auto isWorse = [](const OpenNode &lhs, const OpenNode &rhs) {
+            if (lhs.mLowerBound != rhs.mLowerBound) {
+                return lhs.mLowerBound > rhs.mLowerBound;
+            }
+            return lhs.mOrderedIndices.size() < rhs.mOrderedIndices.size();
+        };
+
+        vector<OpenNode> openNodes(1);
+        openNodes.front().mLowerBound = computeLowerBound(cfg, globalState);
+        while (!openNodes.empty()) {
+            globalState.mLowerBound = openNodes.front().mLowerBound;
+            publishBound(cfg, globalState, globalState.mLowerBound);
+            if (globalState.mDeadline.reached()) {
+                globalState.mTimeLimitReached = true;
                 return;
             }
+
+            pop_heap(openNodes.begin(), openNodes.end(), isWorse);
+            OpenNode node = move(openNodes.back());
+            openNodes.pop_back();
+
+            // The node has the least lower bound, so all open nodes are pruned with it.
+            if (!obj.isBetter(node.mLowerBound, globalState.mResult.getObjectiveValue())
+                || !obj.isBetter(node.mLowerBound, cfg.getIncumbentObjectiveValue())) {
+                return;
+            }
+
+            const int depth = (int)node.mOrderedIndices.size();
+            globalState.mRemainingOperationIndices.clear();
+            for (int operationIndex = 0; operationIndex < numOperations; operationIndex++) {
+                globalState.mRemainingOperationIndices.insert(operationIndex);
+            }
+            for (int position = 0; position < depth; position++) {
+                globalState.mCurrentOrdered[position] = mIns.getOperation(node.mOrderedIndices[position]);
+                globalState.mRemainingOperationIndices.erase(node.mOrderedIndices[position]);
+            }
+            if (depth > 0) {
+                globalState.mAlg.restoreCheckpoint(globalState.mCurrentOrdered, depth - 1, node.mCheckpoint);
+            }
+
+            if ((int)openNodes.size() >= scfg.mMaxOpenNodes) {
+                // Too many open nodes, the subtree is searched depth-first.
+                globalState.mOuterLowerBound = openNodes.empty() ? obj.worstValue() : openNodes.front().mLowerBound;
+                inBranchDfs(cfg, globalState, node.mLowerBound);
+                if (globalState.mTimeLimitReached) {
+                    return;
+                }
+                continue;
+            }
+
+            globalState.mNumNodes++;
+            Telemetry::count(Telemetry::NODES);
+
+            for (int operationIndex : createBranchOnOrder(globalState)) {
+                globalState.mCurrentOrdered[depth] = mIns.getOperation(operationIndex);
+                if (globalState.mAlg.appendPosition(globalState.mCurrentOrdered, depth) == FeasibilityResult::INFEASIBLE) {
+                    globalState.mNumInfeasibleNodes++;
+                    continue;
+                }
+
+                if (depth + 1 == numOperations) {
+                    updateSolution(cfg, globalState);
+                    continue;
+                }
+
+                globalState.mRemainingOperationIndices.erase(operationIndex);
+                double lowerBound = max(node.mLowerBound, obj.computeLowerBoundChu(mIns,
+                                                                                   globalState.mCurrentOrdered,
+                                                                                   globalState.mAlg.getStartTimes(),
+                                                                                   globalState.mRemainingOperationIndices));
+                globalState.mRemainingOperationIndices.insert(operationIndex);
+                if (!obj.isBetter(lowerBound, globalState.mResult.getObjectiveValue())
+                    || !obj.isBetter(lowerBound, cfg.getIncumbentObjectiveValue())) {
+                    globalState.mNumPrunedNodes++;
+                    continue;
+                }
+
+                OpenNode child;
+                child.mLowerBound = lowerBound;
+                child.mOrderedIndices = node.mOrderedIndices;
+                child.mOrderedIndices.push_back(operationIndex);
+                globalState.mAlg.saveCheckpoint(globalState.mCurrentOrdered, depth, child.mCheckpoint);
+                openNodes.push_back(move(child));
+                push_heap(openNodes.begin(), openNodes.end(), isWorse);
+            }
+        }
+    }
+
+    template <typename Alg>
+    vector<int> BranchAndBoundOnOrder::createBranchOnOrder(const GlobalState<Alg> &globalState) const {
+        vector<int> branchOnOrder;
+        for (int operationIndex : globalState.mRemainingOperationIndices) {
+            if (!globalState.mIsFixed[operationIndex]) {
+                branchOnOrder.push_back(operationIndex);
+            }
+        }
+
+        // Branching priority.
+        sort(branchOnOrder.begin(), branchOnOrder.end(), [&](const int lhs, const int rhs) {
+            // TODO (refactoring): selectable by specialised config.
+            return mIns.getOperation(lhs)->getDueDate() < mIns.getOperation(rhs)->getDueDate();
+        });
+
+        return branchOnOrder;
+    }
+
+    template <typename Alg>
+    void BranchAndBoundOnOrder::updateSolution(const Solver::Config &cfg, GlobalState<Alg> &globalState) {
+        const Objective &obj = *cfg.getObjective();
+        double objVal = obj.compute(mIns, globalState.mAlg.getStartTimes());
+        if (obj.isBetter(objVal, globalState.mResult.getObjectiveValue())) {
+            globalState.mResult.setSolution(Solver::Result::Status::FEASIBLE,
+                                            globalState.mAlg.getStartTimes(),
+                                            objVal);
+            cfg.publishIncumbent(globalState.mAlg.getStartTimes(), objVal);
         }
     }
 }
@@ -30,34 +30,119 @@
 #include <set>
 
 #include "../../utils/Stopwatch.h"
+#include "../../utils/Deadline.h"
 #include "../../instance/Operation.h"
 #include "../../instance/Instance.h"
-#include "../fixed-order/RobustScheduleFixedOrderDefault.h"
 #include "../Solver.h"
 
 namespace rseclp {
     using namespace std;
 
     class BranchAndBoundOnOrder : public Solver {
+    public:
+        class Config {
+        public:
+            static const string KEY_NODE_SELECTION;
+            static const string KEY_MAX_OPEN_NODES;
+
+            static const string NODE_SELECTION_DFS;
+            static const string NODE_SELECTION_BEST_FIRST;
+
+            const string mNodeSelection;
+            // Best-first search keeps at most this many open nodes, the subtrees of further nodes are searched
+            // depth-first.
+            const int mMaxOpenNodes;
+
+            Config(const string nodeSelection, const int maxOpenNodes);
+
+            static Config createFrom(const Solver::Config &cfg);
+        };
+
     private:
+        // The depth-first search publishes the bound of its open nodes every this many branched nodes.
+        static const long NUM_NODES_PER_BOUND;
+
         const Instance &mIns;
 
+        template <typename Alg>
         class GlobalState {
 
         public:
-            RobustScheduleFixedOrderDefault mAlg;
+            Alg mAlg;
             Result mResult;
             bool mTimeLimitReached;
             Stopwatch mStopwatch;
+            Deadline mDeadline;
             vector<const Operation*> mCurrentOrdered;
             set<int> mRemainingOperationIndices;
+            // Operations from this position on are kept in the order of mCurrentOrdered and not branched on.
+            int mWindowEnd;
+            vector<bool> mIsFixed;
+            // Least lower bound of the open nodes when the time limit was reached.
+            double mLowerBound;
+            // Lower bounds of the children not yet searched on each level of the depth-first search, as suffix minima
+            // indexed by the next child.
+            vector<vector<double>> mOpenLowerBounds;
+            vector<int> mNextChildren;
+            // Engine checkpoints of the bounded children, indexed by the position and the child, reused between nodes.
+            vector<vector<vector<int>>> mCheckpoints;
+            // Least lower bound of the open nodes outside the depth-first search, i.e. of the best-first search.
+            double mOuterLowerBound;
+            // Only the search over the whole order publishes its bound, the last published one is kept.
+            bool mPublishesBound;
+            double mPublishedBound;
+            // Branched nodes, the leaves are not counted.
+            long mNumNodes;
+            long mNumPrunedNodes;
+            long mNumInfeasibleNodes;
+
+            GlobalState(const Instance &ins, const Solver::Config &cfg, Result result);
+        };
+
+        template <typename Alg>
+        Solver::Result solveWith(const Solver::Config &cfg);
 
-            GlobalState(const Instance &ins, Result result);
+        template <typename Alg>
+        Solver::Result solveWindowWith(const Solver::Config &cfg,
+                                       const vector<const Operation*> &ordered,
+                                       const int windowStart,
+                                       const int windowEnd);
+
+        template <typename Alg>
+        void setInitialSolution(const Solver::Config &cfg, GlobalState<Alg> &globalState);
+
+        template <typename Alg>
+        void adoptIncumbent(const Solver::Config &cfg, GlobalState<Alg> &globalState);
+
+        // The lower bound of the current node is given by its parent.
+        template <typename Alg>
+        void inBranchDfs(const Solver::Config &cfg, GlobalState<Alg> &globalState, const double lowerBound);
+
+        template <typename Alg>
+        double computeLowerBound(const Solver::Config &cfg, GlobalState<Alg> &globalState) const;
+
+        template <typename Alg>
+        double computeOpenLowerBound(const GlobalState<Alg> &globalState, const double lowerBound) const;
+
+        template <typename Alg>
+        void publishBound(const Solver::Config &cfg, GlobalState<Alg> &globalState, const double bound) const;
+
+        // Open nodes are stored as the prefix of the order and the checkpoint of the engine after it.
+        class OpenNode {
+        public:
+            double mLowerBound;
+            vector<int> mOrderedIndices;
+            vector<int> mCheckpoint;
         };
 
-        void setInitialSolution(const Solver::Config &cfg, GlobalState &globalState);
+        template <typename Alg>
+        void inBestFirst(const Solver::Config &cfg, const Config &scfg, GlobalState<Alg> &globalState);
 
-        void inBranchDfs(const Solver::Config &cfg, GlobalState &globalState);
+        template <typename Alg>
+        vector<int> createBranchOnOrder(const GlobalState<Alg> &globalState) const;
+
+        template <typename Alg>
+        void updateSolution(const Solver::Config &cfg, GlobalState<Alg> &globalState);
 
 
     public:
@@ -66,6 +151,13 @@ namespace rseclp {
         BranchAndBoundOnOrder(const Instance &ins);
 
         virtual Solver::Result solve(const Solver::Config &cfg);
+
+        // Reorders the operations at positions [windowStart, windowEnd) of the order, the other positions are kept.
+        // Only orders strictly better than the given one are returned, INFEASIBLE means that no such order exists.
+        Solver::Result solveWindow(const Solver::Config &cfg,
+                                   const vector<const Operation*> &ordered,
+                                   const int windowStart,
+                                   const int windowEnd);
     };
 }
 
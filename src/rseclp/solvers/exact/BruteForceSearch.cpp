@@ -27,18 +27,33 @@
 #include <algorithm>
 #include <numeric>
 #include "BruteForceSearch.h"
-#include "../fixed-order/RobustScheduleFixedOrderDefault.h"
+#include "../fixed-order/RobustScheduleFixedOrder2016B.h"
+#include "../fixed-order/RobustScheduleFixedOrderOptimised.h"
+#include "../fixed-order/BatchFixedOrderEvaluator.h"
 #include "../../utils/Stopwatch.h"
+#include "../../utils/Deadline.h"
 
 namespace rseclp {
+    const int BruteForceSearch::PERMUTATION_BATCH_SIZE = 256;
+
     BruteForceSearch::BruteForceSearch(const Instance &ins) : mIns(ins) {}
 
     Solver::Result BruteForceSearch::solve(const Solver::Config &cfg) {
+        if (cfg.getFixedOrderEngine() == FixedOrderEngine::FIXED_ORDER_OPTIMISED) {
+            return solveWith<RobustScheduleFixedOrderOptimised>(cfg);
+        }
+
+        return solveWith<RobustScheduleFixedOrder2016B>(cfg);
+    }
+
+    template <typename Alg>
+    Solver::Result BruteForceSearch::solveWith(const Solver::Config &cfg) {
         Stopwatch stopwatch;
         stopwatch.start();
+        Deadline deadline(cfg.getTimeLimit(), cfg.getCancellationFlag());
 
         const Objective &obj = *cfg.getObjective();
-        RobustScheduleFixedOrderDefault alg(mIns);
+        BatchFixedOrderEvaluator<Alg> evaluator(mIns, obj);
 
         vector<int> orderedOperationIndices(mIns.getNumOperations(), 0);
         iota(orderedOperationIndices.begin(), orderedOperationIndices.end(), 0);
@@ -46,19 +61,35 @@ namespace rseclp {
         Result result(mIns.getNumOperations(),
                       cfg.getUseInitStartTimes() ? obj.compute(mIns, cfg.getInitStartTimes()) : obj.worstValue());
         bool timeLimitReached = false;
-        do {
-            if (stopwatch.timeLimitReached(cfg.getTimeLimit())) {
+        bool hasNextPermutation = true;
+        while (hasNextPermutation) {
+            if (deadline.reached()) {
                 timeLimitReached = true;
                 break;
             }
 
-            if (alg.create(mIns.getOperationsByOrder(orderedOperationIndices)) == FeasibilityResult::FEASIBLE) {
-                double objVal = obj.compute(mIns, alg.getStartTimes());
-                if (obj.isBetter(objVal, result.getObjectiveValue())) {
-                    result.setSolution(Solver::Result::Status::FEASIBLE, alg.getStartTimes(), objVal);
+            // Consecutive permutations share long prefixes, which the evaluator reuses.
+            evaluator.clear();
+            while (hasNextPermutation && evaluator.getNumOrders() < PERMUTATION_BATCH_SIZE) {
+                evaluator.addOrder(mIns.getOperationsByOrder(orderedOperationIndices));
+                hasNextPermutation = next_permutation(orderedOperationIndices.begin(), orderedOperationIndices.end());
+            }
+            evaluator.evaluate();
+
+            for (int order = 0; order < evaluator.getNumOrders(); order++) {
+                if (evaluator.isFeasible(order) && obj.isBetter(evaluator.getObjectiveValue(order), result.getObjectiveValue())) {
+                    auto startTimes = evaluator.getStartTimes(order);
+                    result.setSolution(Solver::Result::Status::FEASIBLE, startTimes, evaluator.getObjectiveValue(order));
+                    cfg.publishIncumbent(startTimes, evaluator.getObjectiveValue(order));
                 }
             }
-        } while (next_permutation(orderedOperationIndices.begin(), orderedOperationIndices.end()));
+        }
+
+        StartTimes incumbentStartTimes;
+        double incumbentObjVal;
+        if (cfg.testAndGetBetterIncumbent(result.getObjectiveValue(), incumbentStartTimes, incumbentObjVal)) {
+            result.setSolution(Solver::Result::Status::FEASIBLE, incumbentStartTimes, incumbentObjVal);
+        }
 
         if (!timeLimitReached) {
             if (result.getStatus() ==Solver::Result::Status::FEASIBLE) {
@@ -35,12 +35,19 @@ namespace rseclp {
 
     class BruteForceSearch : public Solver {
     private:
+        // Permutations are evaluated in batches of this size, the deadline is checked between them.
+        static const int PERMUTATION_BATCH_SIZE;
+
         const Instance &mIns;
 
     public:
         BruteForceSearch(const Instance &ins);
 
         virtual Solver::Result solve(const Solver::Config &cfg);
+
+    private:
+        template <typename Alg>
+        Solver::Result solveWith(const Solver::Config &cfg);
     };
 }
 
@@ -0,0 +1,538 @@
+/*
+    
+    Copyright (C) 2017 Czech Technical University in Prague
+    The MIT License (MIT)
+    
+    Permission is hereby granted, free of charge, to any person obtaining
+    a copy of this software and associated documentation files
+    (the "Software"), to deal in the Software without restriction,
+    including without limitation the rights to use, copy, modify, merge,
+    publish, distribute, sublicense, and/or sell copies of the Software,
+    and to permit persons to whom the Software is furnished to do so,
+    subject to the following conditions:
+    
+    The above copyright notice and this permission notice shall be
+    included in all copies or substantial portions of the Software.
+    
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+    EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+    MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+    IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+    CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+    TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+    SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+#include <cassert>
+#include <cmath>
+#include <algorithm>
+#include "ConstraintPropagation.h"
+#include "../../objectives/TotalTardiness.h"
+#include "../../feasibility-checkers/FeasibilityChecker.h"
+#include "../../utils/GeneralUtils.h"
+#include "../fixed-order/RobustScheduleFixedOrder2016B.h"
+#include "../fixed-order/RobustScheduleFixedOrderOptimised.h"
+
+namespace rseclp {
+
+    const string ConstraintPropagation::KEY_SOLVER = "ConstraintPropagation";
+
+    const string ConstraintPropagation::Config::KEY_EDGE_FINDING = "edgeFinding";
+    const string ConstraintPropagation::Config::KEY_ENERGY_PROPAGATION = "energyPropagation";
+
+    ConstraintPropagation::Config::Config(bool edgeFinding, bool energyPropagation)
+            : mEdgeFinding(edgeFinding),
+              mEnergyPropagation(energyPropagation) { }
+
+    ConstraintPropagation::Config ConstraintPropagation::Config::createFrom(const Solver::Config &cfg) {
+        auto &scfg = cfg.getSpecialisedConfig();
+
+        return ConstraintPropagation::Config(scfg.getValue<bool>(KEY_SOLVER, KEY_EDGE_FINDING, true),
+                                             scfg.getValue<bool>(KEY_SOLVER, KEY_ENERGY_PROPAGATION, true));
+    }
+
+    template <typename Alg>
+    ConstraintPropagation::GlobalState<Alg>::GlobalState(const Instance &ins, const Solver::Config &cfg, Result result)
+            : mAlg(ins),
+              mResult(move(result)),
+              mDeadline(cfg.getTimeLimit(), cfg.getCancellationFlag()),
+              mCurrentOrdered(ins.getNumOperations(), nullptr),
+              mNumNodes(0),
+              mNumFailures(0) {
+        mTimeLimitReached = false;
+        for (int operationIndex = 0; operationIndex < ins.getNumOperations(); operationIndex++) {
+            mRemainingOperationIndices.insert(operationIndex);
+        }
+    }
+
+    ConstraintPropagation::ConstraintPropagation(const Instance &ins) : mIns(ins) {
+        createEnergyWindows();
+    }
+
+    Solver::Result ConstraintPropagation::solve(const Solver::Config &cfg) {
+        assert(cfg.getObjective()->getType() == Objective::Type::TOTAL_TARDINESS);
+
+        auto scfg = ConstraintPropagation::Config::createFrom(cfg);
+        if (cfg.getFixedOrderEngine() == FixedOrderEngine::FIXED_ORDER_OPTIMISED) {
+            return solveWith<RobustScheduleFixedOrderOptimised>(cfg, scfg);
+        }
+
+        return solveWith<RobustScheduleFixedOrder2016B>(cfg, scfg);
+    }
+
+    void ConstraintPropagation::createEnergyWindows() {
+        for (const MeteringInterval *pMeteringInterval : mIns.getMeteringIntervals()) {
+            const MeteringInterval &meteringInterval = *pMeteringInterval;
+            for (int deviation = 0; deviation <= mIns.getMaxDeviation(); deviation++) {
+                mEnergyWindows.push_back({meteringInterval.getStart() - deviation,
+                                          meteringInterval.getEnd() - deviation,
+                                          meteringInterval.getMaxEnergyConsumption()});
+            }
+        }
+
+        sort(mEnergyWindows.begin(), mEnergyWindows.end(), [](const EnergyWindow &lhs, const EnergyWindow &rhs) {
+            return lhs.mStart < rhs.mStart;
+        });
+    }
+
+    template <typename Alg>
+    Solver::Result ConstraintPropagation::solveWith(const Solver::Config &cfg, const ConstraintPropagation::Config &scfg) {
+        GlobalState<Alg> globalState(mIns, cfg, Solver::Result(mIns.getNumOperations(), cfg.getObjective()->worstValue()));
+
+        globalState.mStopwatch.start();
+        setInitialSolution(cfg, globalState);
+
+        Domains domains = createRootDomains<Alg>();
+        inBranchDfs(cfg, scfg, globalState, domains, 0);
+        adoptIncumbent(cfg, globalState);
+        if (!globalState.mTimeLimitReached) {
+            if (globalState.mResult.getStatus() == Solver::Result::FEASIBLE) {
+                globalState.mResult.setStatus(Solver::Result::OPTIMAL);
+            }
+            else {
+                globalState.mResult.setStatus(Solver::Result::INFEASIBLE);
+            }
+        }
+        globalState.mStopwatch.stop();
+
+        globalState.mResult.setOptional("numNodes", to_string(globalState.mNumNodes));
+        globalState.mResult.setOptional("numFailures", to_string(globalState.mNumFailures));
+        globalState.mResult.setSolverRuntime(globalState.mStopwatch.duration());
+
+        return globalState.mResult;
+    }
+
+    template <typename Alg>
+    void ConstraintPropagation::setInitialSolution(const Solver::Config &cfg, GlobalState<Alg> &globalState) {
+        if (cfg.getUseInitStartTimes()) {
+            auto &initStartTimes = cfg.getInitStartTimes();
+            if (FeasibilityChecker(mIns).areFeasible(initStartTimes)) {
+                globalState.mResult.setSolution(Solver::Result::FEASIBLE,
+                                                initStartTimes,
+                                                cfg.getObjective()->compute(mIns, initStartTimes));
+            }
+        }
+
+        // Earliest due date order gives the first bound for the tardiness propagation.
+        vector<const Operation*> ordered(mIns.getOperations());
+        stable_sort(ordered.begin(), ordered.end(), [](const Operation *lhs, const Operation *rhs) {
+            return lhs->getDueDate() < rhs->getDueDate();
+        });
+
+        Alg alg(mIns);
+        if (alg.create(ordered) == FeasibilityResult::FEASIBLE) {
+            double objVal = cfg.getObjective()->compute(mIns, alg.getStartTimes());
+            if (cfg.getObjective()->isBetter(objVal, globalState.mResult.getObjectiveValue())) {
+                globalState.mResult.setSolution(Solver::Result::FEASIBLE, alg.getStartTimes(), objVal);
+                cfg.publishIncumbent(alg.getStartTimes(), objVal);
+            }
+        }
+
+        adoptIncumbent(cfg, globalState);
+    }
+
+    template <typename Alg>
+    void ConstraintPropagation::adoptIncumbent(const Solver::Config &cfg, GlobalState<Alg> &globalState) {
+        StartTimes incumbentStartTimes;
+        double incumbentObjVal;
+        if (cfg.testAndGetBetterIncumbent(globalState.mResult.getObjectiveValue(), incumbentStartTimes, incumbentObjVal)) {
+            globalState.mResult.setSolution(Solver::Result::FEASIBLE, incumbentStartTimes, incumbentObjVal);
+        }
+    }
+
+    template <typename Alg>
+    ConstraintPropagation::Domains ConstraintPropagation::createRootDomains() const {
+        Domains domains;
+        for (const Operation *pOperation : mIns.getOperations()) {
+            const Operation &operation = *pOperation;
+
+            // The other operations only add energy, so no robust schedule starts the operation before its robust
+            // start time when scheduled alone.
+            int est = mIns.getMaximumStartTime() + 1;
+            Alg alg(mIns);
+            if (alg.create({&operation}, 0) == FeasibilityResult::FEASIBLE) {
+                est = max(operation.getReleaseTime(), alg.getStartTimes()[operation]);
+            }
+
+            domains.mEsts.push_back(est);
+            domains.mLsts.push_back(mIns.getMaximumStartTime());
+        }
+
+        return domains;
+    }
+
+    template <typename Alg>
+    void ConstraintPropagation::inBranchDfs(const Solver::Config &cfg,
+                                            const ConstraintPropagation::Config &scfg,
+                                            GlobalState<Alg> &globalState,
+                                            Domains &domains,
+                                            int scheduledTardiness) {
+        if (globalState.mTimeLimitReached) {
+            return;
+        }
+
+        if (globalState.mDeadline.reached()) {
+            globalState.mTimeLimitReached = true;
+            return;
+        }
+
+        globalState.mNumNodes++;
+        Telemetry::count(Telemetry::NODES);
+
+        const TotalTardiness &obj = (const TotalTardiness&) *cfg.getObjective();
+        if (globalState.mRemainingOperationIndices.size() == 0) {
+            // Leaf node.
+            double objVal = obj.compute(mIns, globalState.mAlg.getStartTimes());
+            if (obj.isBetter(objVal, globalState.mResult.getObjectiveValue())) {
+                globalState.mResult.setSolution(Solver::Result::Status::FEASIBLE,
+                                                globalState.mAlg.getStartTimes(),
+                                                objVal);
+                cfg.publishIncumbent(globalState.mAlg.getStartTimes(), objVal);
+            }
+            return;
+        }
+
+        // Solutions published by other solvers bound the search as well.
+        double upperBound = globalState.mResult.getObjectiveValue();
+        if (obj.isBetter(cfg.getIncumbentObjectiveValue(), upperBound)) {
+            upperBound = cfg.getIncumbentObjectiveValue();
+        }
+        // Tardiness is integral, so the improving solutions have total tardiness at most upper bound - 1.
+        bool hasUpperBound = upperBound < obj.worstValue();
+        int maxTotalTardiness = hasUpperBound ? (int)ceil(upperBound - 0.5) - 1 : 0;
+
+        int forPosition = mIns.getNumOperations() - (int)globalState.mRemainingOperationIndices.size();
+        vector<const Operation*> scheduled(globalState.mCurrentOrdered.begin(),
+                                           next(globalState.mCurrentOrdered.begin(), forPosition));
+        if (!propagate(scfg,
+                       scheduled,
+                       globalState.mAlg.getStartTimes(),
+                       globalState.mRemainingOperationIndices,
+                       hasUpperBound,
+                       maxTotalTardiness,
+                       scheduledTardiness,
+                       domains)) {
+            globalState.mNumFailures++;
+            return;
+        }
+
+        double lowerBound = obj.computeLowerBoundChu(mIns,
+                                                     globalState.mCurrentOrdered,
+                                                     globalState.mAlg.getStartTimes(),
+                                                     globalState.mRemainingOperationIndices);
+        lowerBound = max(lowerBound,
+                         (double)(scheduledTardiness + computeTardinessLowerBound(globalState.mRemainingOperationIndices, domains)));
+        if (!obj.isBetter(lowerBound, upperBound)) {
+            return;
+        }
+
+        // Branch over all remaining operations, the ones that may start earliest first.
+        auto branchOnOrder = vector<int>(globalState.mRemainingOperationIndices.begin(),
+                                         globalState.mRemainingOperationIndices.end());
+        stable_sort(branchOnOrder.begin(), branchOnOrder.end(), [&](const int lhs, const int rhs) {
+            if (domains.mEsts[lhs] != domains.mEsts[rhs]) {
+                return domains.mEsts[lhs] < domains.mEsts[rhs];
+            }
+            return mIns.getOperation(lhs)->getDueDate() < mIns.getOperation(rhs)->getDueDate();
+        });
+
+        for (int operationIndex : branchOnOrder) {
+            const Operation *pOperation = mIns.getOperation(operationIndex);
+
+            globalState.mCurrentOrdered[forPosition] = pOperation;
+            globalState.mRemainingOperationIndices.erase(operationIndex);
+
+            // Robust start time is validated by the engine, the domains only prune.
+            if (globalState.mAlg.appendPosition(globalState.mCurrentOrdered, forPosition) == FeasibilityResult::FEASIBLE) {
+                int startTime = globalState.mAlg.getStartTimes()[*pOperation];
+                if (startTime <= domains.mLsts[operationIndex]) {
+                    Domains childDomains = domains;
+                    childDomains.mEsts[operationIndex] = startTime;
+                    childDomains.mLsts[operationIndex] = startTime;
+
+                    int completionTime = startTime + pOperation->getProcessingTime();
+                    for (int remainingOperationIndex : globalState.mRemainingOperationIndices) {
+                        childDomains.mEsts[remainingOperationIndex] = max(childDomains.mEsts[remainingOperationIndex],
+                                                                          completionTime);
+                    }
+
+                    inBranchDfs(cfg,
+                                scfg,
+                                globalState,
+                                childDomains,
+                                scheduledTardiness + max(0, completionTime - pOperation->getDueDate()));
+                }
+                else {
+                    globalState.mNumFailures++;
+                }
+            }
+
+            globalState.mRemainingOperationIndices.insert(operationIndex);
+
+            if (globalState.mTimeLimitReached) {
+                return;
+            }
+        }
+    }
+
+    bool ConstraintPropagation::propagate(const ConstraintPropagation::Config &scfg,
+                                          const vector<const Operation*> &scheduled,
+                                          const StartTimes &startTimes,
+                                          const set<int> &remaining,
+                                          bool hasUpperBound,
+                                          int maxTotalTardiness,
+                                          int scheduledTardiness,
+                                          Domains &domains) const {
+        // Domains only shrink, so the fixpoint is reached in finitely many rounds.
+        bool changed = true;
+        while (changed) {
+            changed = false;
+
+            for (int operationIndex : remaining) {
+                if (domains.mEsts[operationIndex] > domains.mLsts[operationIndex]) {
+                    return false;
+                }
+            }
+
+            if (hasUpperBound && !propagateTardiness(remaining, maxTotalTardiness, scheduledTardiness, domains, changed)) {
+                return false;
+            }
+
+            if (scfg.mEdgeFinding && !propagateEdgeFinding(remaining, domains, changed)) {
+                return false;
+            }
+
+            if (scfg.mEnergyPropagation && !propagateEnergy(scheduled, startTimes, remaining, domains, changed)) {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    int ConstraintPropagation::computeTardinessLowerBound(const set<int> &remaining, const Domains &domains) const {
+        int lowerBound = 0;
+        for (int operationIndex : remaining) {
+            const Operation &operation = *mIns.getOperation(operationIndex);
+            lowerBound += max(0, domains.mEsts[operationIndex] + operation.getProcessingTime() - operation.getDueDate());
+        }
+        return lowerBound;
+    }
+
+    bool ConstraintPropagation::propagateTardiness(const set<int> &remaining,
+                                                   int maxTotalTardiness,
+                                                   int scheduledTardiness,
+                                                   Domains &domains,
+                                                   bool &changed) const {
+        int lowerBound = scheduledTardiness + computeTardinessLowerBound(remaining, domains);
+        if (lowerBound > maxTotalTardiness) {
+            return false;
+        }
+
+        // Tardiness of an operation may grow only by the slack left by the others.
+        for (int operationIndex : remaining) {
+            const Operation &operation = *mIns.getOperation(operationIndex);
+            int minTardiness = max(0, domains.mEsts[operationIndex] + operation.getProcessingTime() - operation.getDueDate());
+            int maxTardiness = minTardiness + maxTotalTardiness - lowerBound;
+            int lst = operation.getDueDate() + maxTardiness - operation.getProcessingTime();
+            if (lst < domains.mLsts[operationIndex]) {
+                domains.mLsts[operationIndex] = lst;
+                changed = true;
+                if (lst < domains.mEsts[operationIndex]) {
+                    return false;
+                }
+            }
+        }
+
+        return true;
+    }
+
+    bool ConstraintPropagation::propagateEdgeFinding(const set<int> &remaining, Domains &domains, bool &changed) const {
+        // Task intervals: operations with est >= from and lct <= to for all pairs of est and lct values.
+        vector<int> operationIndices(remaining.begin(), remaining.end());
+        vector<int> ests;
+        vector<int> lcts;
+        for (int operationIndex : operationIndices) {
+            ests.push_back(domains.mEsts[operationIndex]);
+            lcts.push_back(domains.mLsts[operationIndex] + mIns.getOperation(operationIndex)->getProcessingTime());
+        }
+
+        auto newEsts = ests;
+        auto newLcts = lcts;
+        const int numOperations = (int)operationIndices.size();
+        vector<bool> inInterval(numOperations);
+        for (int from : ests) {
+            for (int to : lcts) {
+                if (from >= to) {
+                    continue;
+                }
+
+                int processingTime = 0;
+                int ect = numeric_limits<int>::min();
+                int lst = numeric_limits<int>::max();
+                for (int i = 0; i < numOperations; i++) {
+                    inInterval[i] = from <= ests[i] && lcts[i] <= to;
+                    if (inInterval[i]) {
+                        int p = mIns.getOperation(operationIndices[i])->getProcessingTime();
+                        processingTime += p;
+                        ect = max(ect, ests[i] + p);
+                        lst = min(lst, lcts[i] - p);
+                    }
+                }
+
+                if (processingTime == 0) {
+                    continue;
+                }
+
+                // Overload.
+                if (from + processingTime > to) {
+                    return false;
+                }
+                ect = max(ect, from + processingTime);
+                lst = min(lst, to - processingTime);
+
+                for (int i = 0; i < numOperations; i++) {
+                    if (inInterval[i]) {
+                        continue;
+                    }
+
+                    int p = mIns.getOperation(operationIndices[i])->getProcessingTime();
+
+                    // Operation i cannot end before all operations of the interval end, so it ends after them.
+                    if (min(from, ests[i]) + processingTime + p > to) {
+                        newEsts[i] = max(newEsts[i], ect);
+                    }
+
+                    // Operation i cannot start after all operations of the interval start, so it starts before them.
+                    if (max(to, lcts[i]) - processingTime - p < from) {
+                        newLcts[i] = min(newLcts[i], lst);
+                    }
+                }
+            }
+        }
+
+        for (int i = 0; i < numOperations; i++) {
+            int operationIndex = operationIndices[i];
+            int newLst = newLcts[i] - mIns.getOperation(operationIndex)->getProcessingTime();
+            if (newEsts[i] > domains.mEsts[operationIndex] || newLst < domains.mLsts[operationIndex]) {
+                domains.mEsts[operationIndex] = newEsts[i];
+                domains.mLsts[operationIndex] = min(domains.mLsts[operationIndex], newLst);
+                changed = true;
+                if (domains.mEsts[operationIndex] > domains.mLsts[operationIndex]) {
+                    return false;
+                }
+            }
+        }
+
+        return true;
+    }
+
+    bool ConstraintPropagation::propagateEnergy(const vector<const Operation*> &scheduled,
+                                                const StartTimes &startTimes,
+                                                const set<int> &remaining,
+                                                Domains &domains,
+                                                bool &changed) const {
+        // Energy profile of the scheduled operations and the compulsory parts [lst, est + p) of the remaining ones.
+        const int horizon = mIns.getHorizon();
+        vector<double> profile(horizon, 0);
+        auto addToProfile = [&](int start, int end, double power) {
+            for (int t = max(0, start); t < min(horizon, end); t++) {
+                profile[t] += power;
+            }
+        };
+
+        for (const Operation *pOperation : scheduled) {
+            addToProfile(startTimes[*pOperation],
+                         startTimes[*pOperation] + pOperation->getProcessingTime(),
+                         pOperation->getPowerConsumption());
+        }
+        for (int operationIndex : remaining) {
+            const Operation &operation = *mIns.getOperation(operationIndex);
+            addToProfile(domains.mLsts[operationIndex],
+                         domains.mEsts[operationIndex] + operation.getProcessingTime(),
+                         operation.getPowerConsumption());
+        }
+
+        vector<double> prefix(horizon + 1, 0);
+        for (int t = 0; t < horizon; t++) {
+            prefix[t + 1] = prefix[t] + profile[t];
+        }
+        auto energyIn = [&](int start, int end) {
+            return prefix[min(horizon, max(0, end))] - prefix[min(horizon, max(0, start))];
+        };
+
+        for (auto &window : mEnergyWindows) {
+            if (GeneralUtils::isGreater(energyIn(window.mStart, window.mEnd), window.mLimit)) {
+                return false;
+            }
+        }
+
+        // Earliest start of an operation such that none of the windows is overloaded.
+        const int length = mIns.getLengthMeteringInterval();
+        for (int operationIndex : remaining) {
+            const Operation &operation = *mIns.getOperation(operationIndex);
+            const int est = domains.mEsts[operationIndex];
+            const int lst = domains.mLsts[operationIndex];
+            const int processingTime = operation.getProcessingTime();
+            const double power = operation.getPowerConsumption();
+
+            int t = est;
+            for (; t <= lst; t++) {
+                // Windows intersecting [t, t + p) start in (t - length, t + p).
+                auto itWindow = lower_bound(mEnergyWindows.begin(), mEnergyWindows.end(), t - length + 1,
+                                            [](const EnergyWindow &window, int start) {
+                                                return window.mStart < start;
+                                            });
+                bool fits = true;
+                for (; itWindow != mEnergyWindows.end() && itWindow->mStart < t + processingTime; itWindow++) {
+                    double energy = energyIn(itWindow->mStart, itWindow->mEnd);
+                    if (lst < est + processingTime) {
+                        energy -= power * GeneralUtils::computeIntervalsIntersectionLength(lst, est + processingTime,
+                                                                                          itWindow->mStart, itWindow->mEnd);
+                    }
+                    energy += power * GeneralUtils::computeIntervalsIntersectionLength(t, t + processingTime,
+                                                                                      itWindow->mStart, itWindow->mEnd);
+                    if (GeneralUtils::isGreater(energy, itWindow->mLimit)) {
+                        fits = false;
+                        break;
+                    }
+                }
+
+                if (fits) {
+                    break;
+                }
+            }
+
+            if (t > lst) {
+                return false;
+            }
+
+            if (t > est) {
+                domains.mEsts[operationIndex] = t;
+                changed = true;
+            }
+        }
+
+        return true;
+    }
+}
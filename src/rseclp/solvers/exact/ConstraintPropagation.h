@@ -0,0 +1,150 @@
+/*
+    
+    Copyright (C) 2017 Czech Technical University in Prague
+    The MIT License (MIT)
+    
+    Permission is hereby granted, free of charge, to any person obtaining
+    a copy of this software and associated documentation files
+    (the "Software"), to deal in the Software without restriction,
+    including without limitation the rights to use, copy, modify, merge,
+    publish, distribute, sublicense, and/or sell copies of the Software,
+    and to permit persons to whom the Software is furnished to do so,
+    subject to the following conditions:
+    
+    The above copyright notice and this permission notice shall be
+    included in all copies or substantial portions of the Software.
+    
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+    EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+    MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+    IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+    CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+    TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+    SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+#ifndef ROBUSTENERGYAWARESCHEDULING_CONSTRAINTPROPAGATION_H
+#define ROBUSTENERGYAWARESCHEDULING_CONSTRAINTPROPAGATION_H
+
+#include <vector>
+#include <set>
+
+#include "../../utils/Stopwatch.h"
+#include "../../utils/Deadline.h"
+#include "../../instance/Operation.h"
+#include "../../instance/Instance.h"
+#include "../Solver.h"
+
+namespace rseclp {
+    using namespace std;
+
+    // Depth-first search over the order of operations, in which the start time domains of the unscheduled operations
+    // are reduced by constraint propagation (tardiness bound, edge-finding for the machine and energy timetabling
+    // for metering intervals and their shifts by deviations). The start times are computed by the fixed-order engine.
+    class ConstraintPropagation : public Solver {
+    public:
+        static const string KEY_SOLVER;
+
+        class Config {
+        public:
+            static const string KEY_EDGE_FINDING;
+            static const string KEY_ENERGY_PROPAGATION;
+
+            const bool mEdgeFinding;
+            const bool mEnergyPropagation;
+
+            Config(bool edgeFinding, bool energyPropagation);
+
+            static Config createFrom(const Solver::Config &cfg);
+        };
+
+        ConstraintPropagation(const Instance &ins);
+
+        virtual Solver::Result solve(const Solver::Config &cfg);
+
+    private:
+        const Instance &mIns;
+
+        // Energy consumed in [start, end) must not exceed the limit in any robust schedule.
+        struct EnergyWindow {
+            int mStart;
+            int mEnd;
+            double mLimit;
+        };
+
+        // Metering intervals and the intervals shifted to the left by each deviation, sorted by start.
+        vector<EnergyWindow> mEnergyWindows;
+
+        // Start time domains [est, lst] indexed by operation.
+        struct Domains {
+            vector<int> mEsts;
+            vector<int> mLsts;
+        };
+
+        template <typename Alg>
+        class GlobalState {
+
+        public:
+            Alg mAlg;
+            Result mResult;
+            bool mTimeLimitReached;
+            Stopwatch mStopwatch;
+            Deadline mDeadline;
+            vector<const Operation*> mCurrentOrdered;
+            set<int> mRemainingOperationIndices;
+            long mNumNodes;
+            long mNumFailures;
+
+            GlobalState(const Instance &ins, const Solver::Config &cfg, Result result);
+        };
+
+        template <typename Alg>
+        Solver::Result solveWith(const Solver::Config &cfg, const ConstraintPropagation::Config &scfg);
+
+        template <typename Alg>
+        void setInitialSolution(const Solver::Config &cfg, GlobalState<Alg> &globalState);
+
+        template <typename Alg>
+        void adoptIncumbent(const Solver::Config &cfg, GlobalState<Alg> &globalState);
+
+        template <typename Alg>
+        Domains createRootDomains() const;
+
+        template <typename Alg>
+        void inBranchDfs(const Solver::Config &cfg,
+                         const ConstraintPropagation::Config &scfg,
+                         GlobalState<Alg> &globalState,
+                         Domains &domains,
+                         int scheduledTardiness);
+
+        void createEnergyWindows();
+
+        bool propagate(const ConstraintPropagation::Config &scfg,
+                       const vector<const Operation*> &scheduled,
+                       const StartTimes &startTimes,
+                       const set<int> &remaining,
+                       bool hasUpperBound,
+                       int maxTotalTardiness,
+                       int scheduledTardiness,
+                       Domains &domains) const;
+
+        bool propagateTardiness(const set<int> &remaining,
+                                int maxTotalTardiness,
+                                int scheduledTardiness,
+                                Domains &domains,
+                                bool &changed) const;
+
+        bool propagateEdgeFinding(const set<int> &remaining, Domains &domains, bool &changed) const;
+
+        bool propagateEnergy(const vector<const Operation*> &scheduled,
+                             const StartTimes &startTimes,
+                             const set<int> &remaining,
+                             Domains &domains,
+                             bool &changed) const;
+
+        int computeTardinessLowerBound(const set<int> &remaining, const Domains &domains) const;
+    };
+}
+
+
+#endif //ROBUSTENERGYAWARESCHEDULING_CONSTRAINTPROPAGATION_H
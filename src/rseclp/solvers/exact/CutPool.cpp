@@ -0,0 +1,211 @@
+/*
+    
+    Copyright (C) 2017 Czech Technical University in Prague
+    The MIT License (MIT)
+    
+    Permission is hereby granted, free of charge, to any person obtaining
+    a copy of this software and associated documentation files
+    (the "Software"), to deal in the Software without restriction,
+    including without limitation the rights to use, copy, modify, merge,
+    publish, distribute, sublicense, and/or sell copies of the Software,
+    and to permit persons to whom the Software is furnished to do so,
+    subject to the following conditions:
+    
+    The above copyright notice and this permission notice shall be
+    included in all copies or substantial portions of the Software.
+    
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+    EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+    MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+    IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+    CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+    TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+    SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+#include <cmath>
+#include <set>
+#include "CutPool.h"
+#include "../../utils/JsonUtils.h"
+#include "../../utils/Telemetry.h"
+
+namespace rseclp {
+
+    mutex CutPool::sMutex;
+
+    CutPool::Cut::Cut(CutType type, double rhs) : mType(type), mRhs(rhs) { }
+
+    void CutPool::Cut::addTerm(const int operationIndex, const Interval<int> &interval) {
+        mTerms.push_back({operationIndex, interval.getStart(), interval.getEnd()});
+    }
+
+    template <typename T>
+    static bool equalVectors(const vector<T> &lhs, const vector<T> &rhs) {
+        if (lhs.size() != rhs.size()) {
+            return false;
+        }
+
+        for (size_t i = 0; i < lhs.size(); i++) {
+            if (fabs((double)lhs[i] - (double)rhs[i]) > 1e-9 * max(1.0, fabs((double)lhs[i]))) {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    bool CutPool::isAtLeastAsConstrained(const Value &pooledInstance, const Instance &ins) {
+        if (!equalVectors(JsonUtils::getVector<int>(pooledInstance, "releaseTimes"), ins.collectReleaseTimes()) ||
+                !equalVectors(JsonUtils::getVector<int>(pooledInstance, "processingTimes"), ins.collectProcessingTimes()) ||
+                !equalVectors(JsonUtils::getVector<double>(pooledInstance, "powerConsumptions"), ins.collectPowerConsumptions()) ||
+                pooledInstance["lengthMeteringInterval"].GetInt() != ins.getLengthMeteringInterval() ||
+                pooledInstance["maxDeviation"].GetInt() > ins.getMaxDeviation()) {
+            return false;
+        }
+
+        auto pooledMaxEnergyConsumptions = JsonUtils::getVector<double>(pooledInstance, "maxEnergyConsumptions");
+        auto maxEnergyConsumptions = ins.collectMaxEnergyConsumptions();
+        if (pooledMaxEnergyConsumptions.size() != maxEnergyConsumptions.size()) {
+            return false;
+        }
+
+        for (size_t i = 0; i < maxEnergyConsumptions.size(); i++) {
+            if (maxEnergyConsumptions[i] > pooledMaxEnergyConsumptions[i] + 1e-9 * max(1.0, fabs(pooledMaxEnergyConsumptions[i]))) {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    bool CutPool::isIdentical(const Value &pooledInstance, const Instance &ins) {
+        return isAtLeastAsConstrained(pooledInstance, ins) &&
+               pooledInstance["maxDeviation"].GetInt() == ins.getMaxDeviation() &&
+               equalVectors(JsonUtils::getVector<int>(pooledInstance, "dueDates"), ins.collectDueDates()) &&
+               equalVectors(JsonUtils::getVector<double>(pooledInstance, "maxEnergyConsumptions"), ins.collectMaxEnergyConsumptions());
+    }
+
+    void CutPool::writeInstance(Document &doc, Value &addTo, const Instance &ins) {
+        JsonUtils::write(doc, addTo, "releaseTimes", ins.collectReleaseTimes());
+        JsonUtils::write(doc, addTo, "dueDates", ins.collectDueDates());
+        JsonUtils::write(doc, addTo, "processingTimes", ins.collectProcessingTimes());
+        JsonUtils::write(doc, addTo, "powerConsumptions", ins.collectPowerConsumptions());
+        addTo.AddMember("maxDeviation", Value(ins.getMaxDeviation()), doc.GetAllocator());
+        addTo.AddMember("lengthMeteringInterval", Value(ins.getLengthMeteringInterval()), doc.GetAllocator());
+        JsonUtils::write(doc, addTo, "maxEnergyConsumptions", ins.collectMaxEnergyConsumptions());
+    }
+
+    // Terms are stored as a flat array of (operation index, start, end) triples.
+    vector<int> CutPool::serialise(const Cut &cut) {
+        vector<int> terms;
+        for (auto &term : cut.mTerms) {
+            terms.push_back(term.mOperationIndex);
+            terms.push_back(term.mStart);
+            terms.push_back(term.mEnd);
+        }
+        return terms;
+    }
+
+    vector<CutPool::Cut> CutPool::load(const path &poolPath, const Instance &ins) {
+        Telemetry::ScopedTimer timer(Telemetry::IO_TIME);
+        lock_guard<mutex> lock(sMutex);
+
+        vector<Cut> cuts;
+        if (!exists(poolPath)) {
+            return cuts;
+        }
+
+        Document doc;
+        JsonUtils::readJsonDocument(poolPath, doc);
+
+        const Value &entries = doc["entries"];
+        for (auto itEntry = entries.Begin(); itEntry != entries.End(); itEntry++) {
+            const Value &pooledInstance = (*itEntry)["instance"];
+            if (!isAtLeastAsConstrained(pooledInstance, ins)) {
+                continue;
+            }
+            bool identical = isIdentical(pooledInstance, ins);
+
+            const Value &pooledCuts = (*itEntry)["cuts"];
+            for (auto itCut = pooledCuts.Begin(); itCut != pooledCuts.End(); itCut++) {
+                auto type = static_cast<CutType>((*itCut)["type"].GetInt());
+                if (type == CutType::DOMINANCE && !identical) {
+                    continue;
+                }
+
+                Cut cut(type, (*itCut)["rhs"].GetDouble());
+                auto terms = JsonUtils::getVector<int>(*itCut, "terms");
+                for (size_t i = 0; i + 2 < terms.size(); i += 3) {
+                    if (terms[i] >= 0 && terms[i] < ins.getNumOperations()) {
+                        cut.addTerm(terms[i], Interval<int>(terms[i + 1], terms[i + 2]));
+                    }
+                }
+                cuts.push_back(cut);
+            }
+        }
+
+        return cuts;
+    }
+
+    void CutPool::save(const path &poolPath, const Instance &ins, const vector<Cut> &cuts) {
+        Telemetry::ScopedTimer timer(Telemetry::IO_TIME);
+        lock_guard<mutex> lock(sMutex);
+
+        Document doc;
+        if (exists(poolPath)) {
+            JsonUtils::readJsonDocument(poolPath, doc);
+        }
+        else {
+            doc.SetObject();
+            Value entries;
+            entries.SetArray();
+            doc.AddMember("entries", entries, doc.GetAllocator());
+        }
+
+        Value &entries = doc["entries"];
+        Value *entry = nullptr;
+        for (auto itEntry = entries.Begin(); itEntry != entries.End(); itEntry++) {
+            if (isIdentical((*itEntry)["instance"], ins)) {
+                entry = &(*itEntry);
+                break;
+            }
+        }
+
+        if (entry == nullptr) {
+            Value newEntry;
+            newEntry.SetObject();
+            Value instance;
+            instance.SetObject();
+            writeInstance(doc, instance, ins);
+            newEntry.AddMember("instance", instance, doc.GetAllocator());
+            Value newCuts;
+            newCuts.SetArray();
+            newEntry.AddMember("cuts", newCuts, doc.GetAllocator());
+            entries.PushBack(newEntry, doc.GetAllocator());
+            entry = &entries[entries.Size() - 1];
+        }
+
+        // Skip the cuts that are already in the entry.
+        Value &pooledCuts = (*entry)["cuts"];
+        set<pair<int, vector<int>>> known;
+        for (auto itCut = pooledCuts.Begin(); itCut != pooledCuts.End(); itCut++) {
+            known.insert(make_pair((*itCut)["type"].GetInt(), JsonUtils::getVector<int>(*itCut, "terms")));
+        }
+
+        for (auto &cut : cuts) {
+            auto terms = serialise(cut);
+            if (!known.insert(make_pair((int)cut.mType, terms)).second) {
+                continue;
+            }
+
+            Value pooledCut;
+            pooledCut.SetObject();
+            pooledCut.AddMember("type", Value((int)cut.mType), doc.GetAllocator());
+            pooledCut.AddMember("rhs", Value(cut.mRhs), doc.GetAllocator());
+            JsonUtils::write(doc, pooledCut, "terms", terms);
+            pooledCuts.PushBack(pooledCut, doc.GetAllocator());
+        }
+
+        JsonUtils::writeJsonDocument(poolPath, doc);
+    }
+}
@@ -0,0 +1,93 @@
+/*
+    
+    Copyright (C) 2017 Czech Technical University in Prague
+    The MIT License (MIT)
+    
+    Permission is hereby granted, free of charge, to any person obtaining
+    a copy of this software and associated documentation files
+    (the "Software"), to deal in the Software without restriction,
+    including without limitation the rights to use, copy, modify, merge,
+    publish, distribute, sublicense, and/or sell copies of the Software,
+    and to permit persons to whom the Software is furnished to do so,
+    subject to the following conditions:
+    
+    The above copyright notice and this permission notice shall be
+    included in all copies or substantial portions of the Software.
+    
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+    EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+    MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+    IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+    CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+    TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+    SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+#ifndef ROBUSTENERGYAWARESCHEDULING_CUTPOOL_H
+#define ROBUSTENERGYAWARESCHEDULING_CUTPOOL_H
+
+#include <mutex>
+#include <vector>
+#include <boost/filesystem.hpp>
+#include <rapidjson/document.h>
+#include "../../instance/Instance.h"
+#include "../../utils/Interval.h"
+
+namespace rseclp {
+    using namespace std;
+    using namespace rapidjson;
+    using namespace boost::filesystem;
+
+    // Cuts of the time-indexed model stored in operation/time terms, so that they can be reused by other solves.
+    // The pool file keeps an entry (instance data and its cuts) for every instance the cuts were learned on.
+    class CutPool {
+    public:
+        enum CutType {
+            // Forbids start times that are not robust, remains valid on any instance that is at least as constrained,
+            // i.e. with the same operations and metering intervals, larger max deviation and lower energy limits.
+            INFEASIBILITY = 0,
+            // Forbids start times dominated by another robust schedule, valid only for an identical instance.
+            DOMINANCE = 1
+        };
+
+        // For every term, sum of the start time variables of the operation in [start, end) and the sum over all terms
+        // is at most rhs.
+        class Cut {
+        public:
+            struct Term {
+                int mOperationIndex;
+                int mStart;
+                int mEnd;
+            };
+
+            CutType mType;
+            vector<Term> mTerms;
+            double mRhs;
+
+            Cut(CutType type, double rhs);
+
+            void addTerm(const int operationIndex, const Interval<int> &interval);
+        };
+
+        // Cuts from the pool that are valid for ins.
+        static vector<Cut> load(const path &poolPath, const Instance &ins);
+
+        // Adds cuts learned on ins to the pool.
+        static void save(const path &poolPath, const Instance &ins, const vector<Cut> &cuts);
+
+    private:
+        // Solvers running in parallel may share the pool file.
+        static mutex sMutex;
+
+        static bool isIdentical(const Value &pooledInstance, const Instance &ins);
+
+        static bool isAtLeastAsConstrained(const Value &pooledInstance, const Instance &ins);
+
+        static void writeInstance(Document &doc, Value &addTo, const Instance &ins);
+
+        static vector<int> serialise(const Cut &cut);
+    };
+}
+
+
+#endif //ROBUSTENERGYAWARESCHEDULING_CUTPOOL_H
@@ -23,12 +23,18 @@
     SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 */
 
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <future>
+#include <numeric>
 #include "LazyConstraints.h"
 #include "../../utils/IlpUtils.h"
 #include "../../utils/GeneralUtils.h"
 #include "../../utils/Stopwatch.h"
 #include "../../feasibility-checkers/FeasibilityChecker.h"
-#include "../fixed-order/RobustScheduleFixedOrderDefault.h"
+#include "../fixed-order/RobustScheduleFixedOrder2016B.h"
+#include "../fixed-order/RobustScheduleFixedOrderOptimised.h"
 #include "../../objectives/TotalTardiness.h"
 
 namespace rseclp {
@@ -37,17 +43,32 @@ namespace rseclp {
     const string LazyConstraints::Config::KEY_GENERATE_CUTTING_CONSTRAINTS_ETFA2016 = "generateCuttingConstraintsETFA2016";
     const string LazyConstraints::Config::KEY_NO_ENERGY_CONSUMPTION_LIMITS = "noEnergyConsumptionLimits";
     const string LazyConstraints::Config::KEY_NO_DEVIATIONS = "noDeviations";
+    const string LazyConstraints::Config::KEY_TIGHT_START_TIME_WINDOWS = "tightStartTimeWindows";
+    const string LazyConstraints::Config::KEY_VARIABLE_NAMES = "variableNames";
+    const string LazyConstraints::Config::KEY_CUT_POOL_PATH = "cutPoolPath";
+    const string LazyConstraints::Config::KEY_PARALLEL_SEPARATION = "parallelSeparation";
+    const string LazyConstraints::Config::KEY_NODE_HEURISTIC = "nodeHeuristic";
 
     LazyConstraints::Config::Config(bool generateCuttingConstraintsOneSolution,
                                     bool generateCuttingConstraintsTowardsOptimal,
                                     bool generateCuttingConstraintsETFA2016,
                                     bool noEnergyConsumptionLimits,
-                                    bool noDeviations)
+                                    bool noDeviations,
+                                    bool tightStartTimeWindows,
+                                    bool variableNames,
+                                    string cutPoolPath,
+                                    bool parallelSeparation,
+                                    bool nodeHeuristic)
             : mGenerateCuttingConstraintsOneSolution(generateCuttingConstraintsOneSolution),
               mGenerateCuttingConstraintsTowardsOptimal(generateCuttingConstraintsTowardsOptimal),
               mGenerateCuttingConstraintsETFA2016(generateCuttingConstraintsETFA2016),
               mNoEnergyConsumptionLimits(noEnergyConsumptionLimits),
               mNoDeviations(noDeviations || noEnergyConsumptionLimits),
+              mTightStartTimeWindows(tightStartTimeWindows),
+              mVariableNames(variableNames),
+              mCutPoolPath(cutPoolPath),
+              mParallelSeparation(parallelSeparation),
+              mNodeHeuristic(nodeHeuristic),
               mNoCallback(mNoDeviations) {}
 
     LazyConstraints::Config LazyConstraints::Config::createFrom(const Solver::Config &cfg) {
@@ -67,57 +88,240 @@ namespace rseclp {
                                                            false),
                                        scfg.getValue<bool>(KEY_SOLVER,
                                                            KEY_NO_DEVIATIONS,
-                                                           false));
+                                                           false),
+                                       scfg.getValue<bool>(KEY_SOLVER,
+                                                           KEY_TIGHT_START_TIME_WINDOWS,
+                                                           true),
+                                       scfg.getValue<bool>(KEY_SOLVER,
+                                                           KEY_VARIABLE_NAMES,
+                                                           false),
+                                       scfg.getValue<string>(KEY_SOLVER,
+                                                             KEY_CUT_POOL_PATH,
+                                                             ""),
+                                       scfg.getValue<bool>(KEY_SOLVER,
+                                                           KEY_PARALLEL_SEPARATION,
+                                                           true),
+                                       scfg.getValue<bool>(KEY_SOLVER,
+                                                           KEY_NODE_HEURISTIC,
+                                                           true));
     }
 
 
-    LazyConstraints::Vars::Vars(const LazyConstraints &super) : mSuper(super) {
-        mMinReleaseTime = (*min_element(super.mIns.getOperations().begin(),
-                                        super.mIns.getOperations().end(),
-                                        [](const Operation *lhs, const Operation *rhs) {
-                                            return lhs->getReleaseTime() < rhs->getReleaseTime();
-                                        }))->getReleaseTime();
+    LazyConstraints::Vars::Vars(const LazyConstraints &super) : mSuper(super), mAllocMin(0), mAllocMax(-1), z(-1) { }
+
+    void LazyConstraints::Vars::setStartTimeWindows(const vector<int> &startTimeMins, const vector<int> &startTimeMaxs) {
+        mStartTimeMins = startTimeMins;
+        mStartTimeMaxs = startTimeMaxs;
+        bs = WindowArray<int>(startTimeMins, startTimeMaxs, -1);
+
+        // Nothing is processed outside [min start time, max completion time).
+        mAllocMin = numeric_limits<int>::max();
+        mAllocMax = 0;
+        for (const Operation *pOperation : mSuper.mIns.getOperations()) {
+            const Operation &operation = *pOperation;
+            mAllocMin = min(mAllocMin, getStartTimeMin(operation));
+            mAllocMax = max(mAllocMax, getStartTimeMax(operation) + operation.getProcessingTime() - 1);
+        }
+        mAllocMax = min(mAllocMax, mSuper.mIns.getHorizon() - 1);
     }
 
     int LazyConstraints::Vars::getStartTimeMin(const Operation &operation) const {
-        return operation.getReleaseTime();
+        return mStartTimeMins[operation.getIndex()];
     }
 
-    int LazyConstraints::Vars::getStartTimeMax(const Operation &/*operation*/) const {
-        return mSuper.mIns.getMaximumStartTime();
+    int LazyConstraints::Vars::getStartTimeMax(const Operation &operation) const {
+        return mStartTimeMaxs[operation.getIndex()];
     }
 
     int LazyConstraints::Vars::getAllocMin() const {
-        return mMinReleaseTime;
+        return mAllocMin;
     }
 
     int LazyConstraints::Vars::getAllocMax() const {
-        return mSuper.mIns.getHorizon() - 1;
+        return mAllocMax;
     }
 
-    LazyConstraints::Callback::Callback(LazyConstraints &super, LazyConstraints::Config scfg)
-            : mSuper(super), mScfg(scfg) {}
+    LazyConstraints::Callback::Callback(LazyConstraints &super, const Solver::Config &cfg, LazyConstraints::Config scfg)
+            : mSuper(super), mCfg(cfg), mScfg(scfg), mPublishedBound(cfg.getObjective()->worstValue()) {}
 
-    void LazyConstraints::Callback::callback() {
-        if (where == GRB_CB_MIPSOL) {
-            const auto startTimes = getStartTimes();
+    void LazyConstraints::Callback::onEvent(const MilpCallback::Event event, MilpCallbackContext &context) {
+        if (mCfg.isCancelled()) {
+            context.abort();
+            return;
+        }
 
-            if (mScfg.mGenerateCuttingConstraintsOneSolution) {
-                generateCuttingConstraintsOneSolution(startTimes);
+        // The bound is published as the search progresses, the trace is locked only when it changes.
+        if (mScfg.mNoCallback == false && context.hasObjectiveBound()) {
+            double bound = context.getObjectiveBound();
+            if (bound != mPublishedBound) {
+                mPublishedBound = bound;
+                mCfg.publishBound(bound);
             }
+        }
+
+        if (event == MilpCallback::Event::SOLUTION && mScfg.mNoCallback == false) {
+            const auto startTimes = getStartTimes(context);
 
-            if (mScfg.mGenerateCuttingConstraintsTowardsOptimal) {
-                generateCuttingConstraintsTowardsOptimal(startTimes);
+            // The same solution may be found repeatedly (e.g. by different threads), its cuts are then only added again.
+            auto itSeparated = mSeparatedCuts.find(startTimes.getBackingArray());
+            if (itSeparated != mSeparatedCuts.end()) {
+                for (auto &cut : itSeparated->second) {
+                    context.addLazy(mSuper.createCutExpr(cut), MilpSense::LESS_EQUAL, cut.mRhs);
+                }
+                return;
             }
 
-            if (mScfg.mGenerateCuttingConstraintsETFA2016) {
-                generateCuttingConstraintsETFA2016(startTimes);
+            auto cuts = separate(startTimes);
+            for (auto &cut : cuts) {
+                addCut(cut, context);
+            }
+            mSeparatedCuts.emplace(startTimes.getBackingArray(), move(cuts));
+        }
+        else if (event == MilpCallback::Event::NODE && mScfg.mNoCallback == false && mScfg.mNodeHeuristic
+                 && context.hasOptimalNodeRelaxation()) {
+            if (mCfg.getFixedOrderEngine() == FixedOrderEngine::FIXED_ORDER_OPTIMISED) {
+                runNodeHeuristic<RobustScheduleFixedOrderOptimised>(context);
+            }
+            else {
+                runNodeHeuristic<RobustScheduleFixedOrder2016B>(context);
             }
         }
     }
 
+    template <typename Alg>
+    void LazyConstraints::Callback::runNodeHeuristic(MilpCallbackContext &context) {
+        const Instance &ins = mSuper.mIns;
+        auto &bs = mSuper.mMasterVars.bs;
+
+        // Operations are ordered by their expected start times in the node relaxation.
+        vector<double> expectedStartTimes(ins.getNumOperations(), 0);
+        {
+            auto values = context.getNodeRelaxation(bs.backingArray().data(), bs.size());
+            int index = 0;
+            for (const Operation *pOperation : ins.getOperations()) {
+                const Operation &operation = *pOperation;
+                int tMin = mSuper.mMasterVars.getStartTimeMin(operation);
+                int tMax = mSuper.mMasterVars.getStartTimeMax(operation);
+
+                double sum = 0;
+                double weightedSum = 0;
+                for (int t = tMin; t <= tMax; t++, index++) {
+                    sum += values[index];
+                    weightedSum += t * values[index];
+                }
+                expectedStartTimes[operation.getIndex()] = sum > 0 ? weightedSum / sum : tMin;
+            }
+        }
+
+        vector<int> order(ins.getNumOperations());
+        iota(order.begin(), order.end(), 0);
+        stable_sort(order.begin(), order.end(), [&expectedStartTimes](int lhs, int rhs) {
+            return expectedStartTimes[lhs] < expectedStartTimes[rhs];
+        });
 
-    void LazyConstraints::Callback::generateCuttingConstraintsOneSolution(const StartTimes &startTimes) {
+        // Consecutive nodes often yield the same order.
+        if (order == mLastNodeHeuristicOrder) {
+            return;
+        }
+        mLastNodeHeuristicOrder = order;
+
+        vector<const Operation*> ordered;
+        for (int operationIndex : order) {
+            ordered.push_back(ins.getOperation(operationIndex));
+        }
+
+        Alg alg(ins);
+        if (alg.create(ordered) != FeasibilityResult::FEASIBLE) {
+            return;
+        }
+        const StartTimes &startTimes = alg.getStartTimes();
+
+        // The solution cannot be expressed if some start time is outside its window.
+        for (const Operation *pOperation : ins.getOperations()) {
+            const Operation &operation = *pOperation;
+            if (startTimes[operation] < mSuper.mMasterVars.getStartTimeMin(operation)
+                || startTimes[operation] > mSuper.mMasterVars.getStartTimeMax(operation)) {
+                return;
+            }
+        }
+
+        double objVal = mCfg.getObjective()->compute(ins, startTimes);
+        mCfg.publishIncumbent(startTimes, objVal);
+        if (!mCfg.getObjective()->isBetter(objVal, context.getBestObjective())) {
+            return;
+        }
+
+        // Remaining variables are completed by the MILP solver.
+        vector<double> values(bs.size(), 0);
+        int index = 0;
+        for (const Operation *pOperation : ins.getOperations()) {
+            const Operation &operation = *pOperation;
+            int tMin = mSuper.mMasterVars.getStartTimeMin(operation);
+            values[index + startTimes[operation] - tMin] = 1;
+            index += mSuper.mMasterVars.getStartTimeMax(operation) - tMin + 1;
+        }
+        context.setSolution(bs.backingArray().data(), values.data(), bs.size());
+        context.setSolution(&mSuper.mMasterVars.z, &objVal, 1);
+        context.useSolution();
+        mNumNodeHeuristicSolutions++;
+    }
+
+    vector<CutPool::Cut> LazyConstraints::Callback::separate(const StartTimes &startTimes) const {
+        vector<function<vector<CutPool::Cut>()>> separators;
+
+        if (mScfg.mGenerateCuttingConstraintsOneSolution) {
+            separators.push_back([this, &startTimes]() {
+                vector<CutPool::Cut> cuts;
+                generateCuttingConstraintsOneSolution(startTimes, cuts);
+                return cuts;
+            });
+        }
+
+        if (mScfg.mGenerateCuttingConstraintsTowardsOptimal) {
+            separators.push_back([this, &startTimes]() {
+                vector<CutPool::Cut> cuts;
+                if (mCfg.getFixedOrderEngine() == FixedOrderEngine::FIXED_ORDER_OPTIMISED) {
+                    generateCuttingConstraintsTowardsOptimal<RobustScheduleFixedOrderOptimised>(startTimes, cuts);
+                }
+                else {
+                    generateCuttingConstraintsTowardsOptimal<RobustScheduleFixedOrder2016B>(startTimes, cuts);
+                }
+                return cuts;
+            });
+        }
+
+        if (mScfg.mGenerateCuttingConstraintsETFA2016) {
+            separators.push_back([this, &startTimes]() {
+                vector<CutPool::Cut> cuts;
+                generateCuttingConstraintsETFA2016(startTimes, cuts);
+                return cuts;
+            });
+        }
+
+        // Separators only read the solution, Gurobi is called from the callback thread when adding the cuts.
+        vector<future<vector<CutPool::Cut>>> futures;
+        if (mScfg.mParallelSeparation) {
+            Telemetry::Registry *telemetry = Telemetry::getRegistry();
+            for (size_t i = 1; i < separators.size(); i++) {
+                futures.push_back(async(launch::async, [&separators, telemetry, i]() {
+                    Telemetry::Scope scope(telemetry);
+                    return separators[i]();
+                }));
+            }
+        }
+
+        vector<CutPool::Cut> cuts;
+        for (size_t i = 0; i < separators.size(); i++) {
+            auto separated = (i == 0 || !mScfg.mParallelSeparation) ? separators[i]() : futures[i - 1].get();
+            cuts.insert(cuts.end(), separated.begin(), separated.end());
+        }
+
+        return cuts;
+    }
+
+
+    void LazyConstraints::Callback::generateCuttingConstraintsOneSolution(const StartTimes &startTimes,
+                                                                          vector<CutPool::Cut> &cuts) const {
         FeasibilityChecker checker(mSuper.mIns);
         if (checker.areFeasible(startTimes)) {
             return;
@@ -130,16 +334,19 @@ namespace rseclp {
             cuttingIntervals.push_back(Interval<int>(startTimeToForbid, startTimeToForbid + 1));
         }
 
-        generateCuttingConstraints(cuttingIntervals);
+        cuts.push_back(createCut(cuttingIntervals, CutPool::CutType::INFEASIBILITY));
     }
 
-    void LazyConstraints::Callback::generateCuttingConstraintsTowardsOptimal(const StartTimes &startTimes) {
+    template <typename Alg>
+    void LazyConstraints::Callback::generateCuttingConstraintsTowardsOptimal(const StartTimes &startTimes,
+                                                                             vector<CutPool::Cut> &cuts) const {
         auto ordered = startTimes.getOperationsOrdered(mSuper.mIns);
-        RobustScheduleFixedOrderDefault alg(mSuper.mIns);
+        Alg alg(mSuper.mIns);
         FeasibilityResult feasibilityResult = alg.create(ordered);
         const StartTimes &robustStartTimes = alg.getStartTimes();
 
         vector<Interval<int>> cuttingIntervals;
+        CutPool::CutType cutType = CutPool::CutType::INFEASIBILITY;
         if (feasibilityResult == FeasibilityResult::INFEASIBLE) {
             // Infeasible order, forbid it.
             for (auto itOperation = ordered.begin(); itOperation != ordered.end(); itOperation++) {
@@ -175,6 +382,8 @@ namespace rseclp {
                 }
             }
 
+            mCfg.publishIncumbent(robustStartTimes, mCfg.getObjective()->compute(mSuper.mIns, robustStartTimes));
+
             if (positionDiff >= mSuper.mIns.getNumOperations()) {
                 // Start times are robust.
                 return;
@@ -218,6 +427,9 @@ namespace rseclp {
                 }
             }
             else {
+                // Robust start times are not violated, only dominated.
+                cutType = CutPool::CutType::DOMINANCE;
+
                 // Operations before operationDiff (exclusive)
                 for (auto itOperation = ordered.begin(); itOperation != itOperationDiff; itOperation++) {
                     const Operation &operation = **itOperation;
@@ -242,11 +454,12 @@ namespace rseclp {
         }
 
         if (cuttingIntervals.size() > 0) {
-            generateCuttingConstraints(ordered, cuttingIntervals);
+            cuts.push_back(createCut(ordered, cuttingIntervals, cutType));
         }
     }
 
-    void LazyConstraints::Callback::generateCuttingConstraintsETFA2016(const StartTimes &startTimes) {
+    void LazyConstraints::Callback::generateCuttingConstraintsETFA2016(const StartTimes &startTimes,
+                                                                       vector<CutPool::Cut> &cuts) const {
         FeasibilityChecker feasibilityChecker(mSuper.mIns);
         if (feasibilityChecker.areFeasible(startTimes)) {
             return;
@@ -315,7 +528,7 @@ namespace rseclp {
 
 
         // TODO (refactoring): current implementation of cutting constraints is not able to handle union of intervals.
-        GRBLinExpr expr = 0;
+        CutPool::Cut cut(CutPool::CutType::INFEASIBILITY, mSuper.mIns.getNumOperations() - 1);
 
         // Operations before head and after lastIntersecting.
         {
@@ -326,8 +539,8 @@ namespace rseclp {
                     continue;
                 }
                 const Operation &operation = *ordered[position];
-                generateCuttingConstraint(operation, Interval<int>(0, startTimes[headOperation] + 1), expr);
-                generateCuttingConstraint(operation, Interval<int>(tBoundary, mSuper.mIns.getMaximumStartTime() + 1), expr);
+                cut.addTerm(operation.getIndex(), Interval<int>(0, startTimes[headOperation] + 1));
+                cut.addTerm(operation.getIndex(), Interval<int>(tBoundary, mSuper.mIns.getMaximumStartTime() + 1));
                 position++;
             }
         }
@@ -336,63 +549,64 @@ namespace rseclp {
         for (int position = headPosition; position < lastIntersectingPosition; position++) {
             const Operation &operation = *ordered[position];
             const Operation &nextOperation = *ordered[position + 1];
-            generateCuttingConstraint(operation, Interval<int>(startTimes[operation], startTimes[nextOperation] + nextOperation.getProcessingTime() + 1 - 1), expr);
+            cut.addTerm(operation.getIndex(), Interval<int>(startTimes[operation], startTimes[nextOperation] + nextOperation.getProcessingTime() + 1 - 1));
         }
 
         // Operation lastIntersecting.
-        generateCuttingConstraint(lastIntersectingOperation, Interval<int>(startTimes[lastIntersectingOperation], tBoundary + 1), expr);
+        cut.addTerm(lastIntersectingOperation.getIndex(), Interval<int>(startTimes[lastIntersectingOperation], tBoundary + 1));
 
-        addLazy(expr <= mSuper.mIns.getNumOperations() - 1);
-        mNumGeneratedLazyConstraints++;
+        cuts.push_back(cut);
     }
 
-    void LazyConstraints::Callback::generateCuttingConstraints(const vector<const Operation*> ordered,
-                                                               const vector<Interval<int>> cuttingIntervals) {
-        GRBLinExpr expr = 0;
+    CutPool::Cut LazyConstraints::Callback::createCut(const vector<const Operation*> ordered,
+                                                      const vector<Interval<int>> cuttingIntervals,
+                                                      CutPool::CutType type) const {
+        CutPool::Cut cut(type, mSuper.mIns.getNumOperations() - 1);
         for (int position = 0; position < mSuper.mIns.getNumOperations(); position++) {
-            generateCuttingConstraint(*ordered[position], cuttingIntervals[position], expr);
+            cut.addTerm(ordered[position]->getIndex(), cuttingIntervals[position]);
         }
 
-        addLazy(expr <= mSuper.mIns.getNumOperations() - 1);
-        mNumGeneratedLazyConstraints++;
+        return cut;
     }
 
-    void LazyConstraints::Callback::generateCuttingConstraints(const vector<Interval<int>> cuttingIntervals) {
-        GRBLinExpr expr = 0;
+    CutPool::Cut LazyConstraints::Callback::createCut(const vector<Interval<int>> cuttingIntervals,
+                                                      CutPool::CutType type) const {
+        CutPool::Cut cut(type, mSuper.mIns.getNumOperations() - 1);
         for (int operationIndex = 0; operationIndex < mSuper.mIns.getNumOperations(); operationIndex++) {
-            generateCuttingConstraint(*mSuper.mIns.getOperation(operationIndex),
-                                      cuttingIntervals[operationIndex],
-                                      expr);
+            cut.addTerm(operationIndex, cuttingIntervals[operationIndex]);
         }
 
-        addLazy(expr <= mSuper.mIns.getNumOperations() - 1);
-        mNumGeneratedLazyConstraints++;
+        return cut;
     }
 
-    void LazyConstraints::Callback::generateCuttingConstraint(const Operation &operation,
-                                                              const Interval<int> &cuttingInterval,
-                                                              GRBLinExpr &expr) {
-        const int tMin = max(cuttingInterval.getStart(), mSuper.mMasterVars.getStartTimeMin(operation));
-        const int tMax = min(cuttingInterval.getEnd() - 1, mSuper.mMasterVars.getStartTimeMax(operation));
-        for (int t = tMin; t <= tMax; t++) {
-            expr += mSuper.mMasterVars.bs(operation.getIndex(), t);
+    void LazyConstraints::Callback::addCut(const CutPool::Cut &cut, MilpCallbackContext &context) {
+        context.addLazy(mSuper.createCutExpr(cut), MilpSense::LESS_EQUAL, cut.mRhs);
+        mNumGeneratedLazyConstraints++;
+        Telemetry::count(Telemetry::CUTS);
+
+        if (!mScfg.mCutPoolPath.empty()) {
+            mGeneratedCuts.push_back(cut);
         }
     }
 
-    StartTimes LazyConstraints::Callback::getStartTimes() {
+    StartTimes LazyConstraints::Callback::getStartTimes(MilpCallbackContext &context) {
         StartTimes startTimes(mSuper.mIns.getNumOperations());
 
+        // Windows of the operations are stored one after another, so all values are read in a single call.
+        auto &bs = mSuper.mMasterVars.bs;
+        auto values = context.getSolution(bs.backingArray().data(), bs.size());
+        int index = 0;
         for (const Operation *pOperation : mSuper.mIns.getOperations()) {
             const Operation &operation = *pOperation;
 
             int tMin = mSuper.mMasterVars.getStartTimeMin(operation);
             int tMax = mSuper.mMasterVars.getStartTimeMax(operation);
-            for (int t = tMin; t <= tMax; t++) {
-                if (getSolution(mSuper.mMasterVars.bs(operation.getIndex(), t)) >= 0.5) {
+            for (int t = tMax; t >= tMin; t--) {
+                if (values[index + t - tMin] >= 0.5) {
                     startTimes[operation] = t;
-                    break;
                 }
             }
+            index += max(0, tMax - tMin + 1);
         }
 
         return startTimes;
@@ -400,7 +614,7 @@ namespace rseclp {
 
     const string LazyConstraints::KEY_SOLVER = "LazyConstraints";
 
-    LazyConstraints::LazyConstraints(const Instance &ins, GRBEnv &env)
+    LazyConstraints::LazyConstraints(const Instance &ins, MilpEnvironment &env)
             : mIns(ins),
               mEnv(env),
               mMasterVars(*this) { }
@@ -411,40 +625,55 @@ namespace rseclp {
 
         auto scfg = LazyConstraints::Config::createFrom(cfg);
 
-        auto envLazyConstraintsBckp = mEnv.get(GRB_IntParam_LazyConstraints);
-        if (scfg.mNoCallback == false) {
-            mEnv.set(GRB_IntParam_LazyConstraints, 1);
+        StartTimes initStartTimes;
+        double initObjVal;
+        bool useInitStartTimes;
+        if (cfg.getFixedOrderEngine() == FixedOrderEngine::FIXED_ORDER_OPTIMISED) {
+            useInitStartTimes = findInitialSolution<RobustScheduleFixedOrderOptimised>(cfg, scfg, initStartTimes, initObjVal);
+            computeStartTimeWindows<RobustScheduleFixedOrderOptimised>(cfg, scfg, useInitStartTimes, initObjVal);
+        }
+        else {
+            useInitStartTimes = findInitialSolution<RobustScheduleFixedOrder2016B>(cfg, scfg, initStartTimes, initObjVal);
+            computeStartTimeWindows<RobustScheduleFixedOrder2016B>(cfg, scfg, useInitStartTimes, initObjVal);
         }
 
-        mMasterModel.reset(new GRBModel(mEnv));
+        mMasterModel = mEnv.createModel();
+        mMasterModel->setLazyConstraints(scfg.mNoCallback == false);
 
         createVariablesMasterModel(cfg, scfg);
-        mMasterModel->update();
-        setInitialSolution(cfg);
+        if (useInitStartTimes) {
+            setInitialSolution(initStartTimes);
+        }
         createConstraintsMasterModel(cfg, scfg);
-        mMasterModel->update();
+        int numReinjectedCuts = 0;
+        if (scfg.mNoCallback == false && !scfg.mCutPoolPath.empty()) {
+            numReinjectedCuts = reinjectPooledCuts(scfg);
+        }
         createObjectiveMasterModel(cfg, scfg);
-        mMasterModel->update();
 
         Solver::Result result(mIns.getNumOperations(), cfg.getObjective()->worstValue());
 
+        // Without the lazy constraints, the callback is still needed for the cancellation.
         auto callback = unique_ptr<LazyConstraints::Callback>(nullptr);
-        if (scfg.mNoCallback == false) {
-            callback.reset(new LazyConstraints::Callback(*this, scfg));
+        if (scfg.mNoCallback == false || cfg.getCancellationFlag() != nullptr) {
+            callback.reset(new LazyConstraints::Callback(*this, cfg, scfg));
             mMasterModel->setCallback(callback.get());
         }
 
         double timeLimitInSeconds = ((double)(cfg.getTimeLimit() - stopwatch.duration()).count()) / 1000.0;
-        mMasterModel->getEnv().set(GRB_DoubleParam_TimeLimit, timeLimitInSeconds);
-        mMasterModel->update();
+        mMasterModel->setTimeLimit(timeLimitInSeconds);
 
-        mMasterModel->optimize();
+        MilpStatus milpStatus = mMasterModel->optimize();
+
+        if (scfg.mNoCallback == false && !scfg.mCutPoolPath.empty()) {
+            CutPool::save(scfg.mCutPoolPath, mIns, callback->mGeneratedCuts);
+        }
 
         Solver::Result::Status status = Solver::Result::Status::NO_SOLUTION;
         double objectiveValue = numeric_limits<double>::max();
         StartTimes startTimes;
-        if (mMasterModel->get(GRB_IntAttr_SolCount) <= 0) {
-            if (mMasterModel->get(GRB_IntAttr_Status) == GRB_INFEASIBLE) {
+        if (mMasterModel->getSolutionCount() <= 0) {
+            if (milpStatus == MilpStatus::INFEASIBLE) {
                 status = Solver::Result::Status::INFEASIBLE;
             }
             else {
@@ -452,26 +681,30 @@ namespace rseclp {
             }
         }
         else {
-            if (mMasterModel->get(GRB_IntAttr_Status) == GRB_OPTIMAL) {
+            if (milpStatus == MilpStatus::OPTIMAL) {
                 status = Solver::Result::Status::OPTIMAL;
             }
             else {
                 status = Solver::Result::Status::FEASIBLE;
             }
-            objectiveValue = mMasterModel->get(GRB_DoubleAttr_ObjVal);
+            objectiveValue = mMasterModel->getObjectiveValue();
             startTimes = getStartTimesFromMasterSolution();
         }
 
         result.setSolution(status, startTimes, objectiveValue);
-
-        if (scfg.mNoCallback == false) {
-            result.setOptional("numGeneratedLazyConstraints", to_string(callback->mNumGeneratedLazyConstraints));
-            result.setOptional("lowerBound", to_string(mMasterModel->get(GRB_DoubleAttr_ObjBoundC)));
+        if (status == Solver::Result::Status::FEASIBLE || status == Solver::Result::Status::OPTIMAL) {
+            cfg.publishIncumbent(startTimes, objectiveValue);
         }
 
-
+        result.setOptional("numStartTimeVariables", to_string(mMasterVars.bs.size()));
         if (scfg.mNoCallback == false) {
-            mEnv.set(GRB_IntParam_LazyConstraints, envLazyConstraintsBckp);
+            result.setOptional("numGeneratedLazyConstraints", to_string(callback->mNumGeneratedLazyConstraints));
+            result.setOptional("numNodeHeuristicSolutions", to_string(callback->mNumNodeHeuristicSolutions));
+            if (!scfg.mCutPoolPath.empty()) {
+                result.setOptional("numReinjectedCuts", to_string(numReinjectedCuts));
+            }
+            result.setOptional("lowerBound", to_string(mMasterModel->getObjectiveBound()));
+            cfg.publishBound(mMasterModel->getObjectiveBound());
         }
 
         stopwatch.stop();
@@ -479,90 +712,185 @@ namespace rseclp {
         return result;
     }
 
-    void LazyConstraints::setInitialSolution(const Solver::Config &cfg) {
-        if (cfg.getUseInitStartTimes()) {
-            auto &initStartTimes = cfg.getInitStartTimes();
-            if (!FeasibilityChecker(mIns).areFeasible(initStartTimes)) {
-                return;
-            }
+    template <typename Alg>
+    bool LazyConstraints::findInitialSolution(const Solver::Config &cfg,
+                                              const LazyConstraints::Config &scfg,
+                                              StartTimes &initStartTimes,
+                                              double &initObjVal) const {
+        bool found = false;
+        initObjVal = cfg.getObjective()->worstValue();
+        if (cfg.getUseInitStartTimes() && FeasibilityChecker(mIns).areFeasible(cfg.getInitStartTimes())) {
+            initStartTimes = cfg.getInitStartTimes();
+            initObjVal = cfg.getObjective()->compute(mIns, initStartTimes);
+            found = true;
+        }
 
-            for (const Operation *pOperation : mIns.getOperations()) {
-                const Operation &operation = *pOperation;
-                int tMin = mMasterVars.getStartTimeMin(operation);
-                int tMax = mMasterVars.getStartTimeMax(operation);
-                if (initStartTimes[operation] < tMin || initStartTimes[operation] > tMax) {
-                    return;
+        StartTimes incumbentStartTimes;
+        double incumbentObjVal;
+        if (cfg.testAndGetBetterIncumbent(initObjVal, incumbentStartTimes, incumbentObjVal)) {
+            initStartTimes = move(incumbentStartTimes);
+            initObjVal = incumbentObjVal;
+            found = true;
+        }
+
+        // Cheap upper bound for the start time windows.
+        if (scfg.mTightStartTimeWindows) {
+            vector<const Operation*> ordered(mIns.getOperations());
+            stable_sort(ordered.begin(), ordered.end(), [](const Operation *lhs, const Operation *rhs) {
+                return lhs->getDueDate() < rhs->getDueDate();
+            });
+
+            Alg alg(mIns);
+            if (alg.create(ordered) == FeasibilityResult::FEASIBLE) {
+                double objVal = cfg.getObjective()->compute(mIns, alg.getStartTimes());
+                if (cfg.getObjective()->isBetter(objVal, initObjVal)) {
+                    initStartTimes = alg.getStartTimes();
+                    initObjVal = objVal;
+                    found = true;
                 }
             }
+        }
 
-            for (const Operation *pOperation : mIns.getOperations()) {
-                const Operation &operation = *pOperation;
-                mMasterVars.bs(operation.getIndex(), initStartTimes[operation]).set(GRB_DoubleAttr_Start, 1);
+        return found;
+    }
+
+    template <typename Alg>
+    void LazyConstraints::computeStartTimeWindows(const Solver::Config &cfg,
+                                                  const LazyConstraints::Config &scfg,
+                                                  bool hasUpperBound,
+                                                  double upperBound) {
+        vector<int> startTimeMins;
+        vector<int> startTimeMaxs;
+        for (const Operation *pOperation : mIns.getOperations()) {
+            const Operation &operation = *pOperation;
+
+            int tMin = operation.getReleaseTime();
+            int tMax = mIns.getMaximumStartTime();
+            if (scfg.mTightStartTimeWindows) {
+                // The other operations only add energy, therefore no robust schedule starts the operation before
+                // its robust start time when scheduled alone. Does not hold for the relaxations.
+                if (scfg.mNoDeviations == false) {
+                    Alg alg(mIns);
+                    if (alg.create({&operation}, 0) == FeasibilityResult::FEASIBLE) {
+                        tMin = min(max(tMin, alg.getStartTimes()[operation]), tMax);
+                    }
+                }
+
+                // Tardiness of a single operation cannot exceed the total tardiness of the upper bound.
+                if (hasUpperBound && cfg.getObjective()->getType() == Objective::Type::TOTAL_TARDINESS) {
+                    int maxTardiness = (int)floor(upperBound);
+                    tMax = max(tMin, min(tMax, operation.getDueDate() + maxTardiness - operation.getProcessingTime()));
+                }
             }
+
+            startTimeMins.push_back(tMin);
+            startTimeMaxs.push_back(tMax);
         }
-    }
 
-    void LazyConstraints::createVariablesMasterModel(const Solver::Config &/*cfg*/, const LazyConstraints::Config &scfg) {
-        mMasterVars.bs = MultiArray<GRBVar>({mIns.getNumOperations(), mIns.getMaximumStartTime() + 1}, GRBVar());
-        mMasterVars.eTime = MultiArray<GRBVar>({mIns.getHorizon()}, GRBVar());
-        mMasterVars.z = mMasterModel->addVar(0, GRB_INFINITY, 0, GRB_CONTINUOUS, IlpUtils::varName("z", {}));
+        mMasterVars.setStartTimeWindows(startTimeMins, startTimeMaxs);
+    }
 
+    void LazyConstraints::setInitialSolution(const StartTimes &initStartTimes) {
         for (const Operation *pOperation : mIns.getOperations()) {
             const Operation &operation = *pOperation;
-
             int tMin = mMasterVars.getStartTimeMin(operation);
             int tMax = mMasterVars.getStartTimeMax(operation);
-            for (int t = tMin; t <= tMax; t++) {
-                mMasterVars.bs(operation.getIndex(), t) = mMasterModel->addVar(0, 1, 0, GRB_BINARY, IlpUtils::varName("bs", {operation.getIndex(), t}));
+            if (initStartTimes[operation] < tMin || initStartTimes[operation] > tMax) {
+                return;
+            }
+        }
+
+        for (const Operation *pOperation : mIns.getOperations()) {
+            const Operation &operation = *pOperation;
+            mMasterModel->setStart(mMasterVars.bs(operation.getIndex(), initStartTimes[operation]), 1);
+        }
+    }
+
+    void LazyConstraints::createVariablesMasterModel(const Solver::Config &/*cfg*/, const LazyConstraints::Config &scfg) {
+        const double infinity = numeric_limits<double>::max();
+
+        mMasterVars.eTime = MultiArray<int>({mIns.getHorizon()}, -1);
+        {
+            vector<string> names = {IlpUtils::varName("z", {})};
+            mMasterVars.z = mMasterModel->addVars(1, 0, infinity, MilpVarType::CONTINUOUS,
+                                                  scfg.mVariableNames ? &names : nullptr);
+        }
+
+        // All start time variables are added in a single call, in the order of the backing array of bs.
+        {
+            int numVars = mMasterVars.bs.size();
+            vector<string> names;
+            if (scfg.mVariableNames) {
+                for (const Operation *pOperation : mIns.getOperations()) {
+                    const Operation &operation = *pOperation;
+                    for (int t = mMasterVars.getStartTimeMin(operation); t <= mMasterVars.getStartTimeMax(operation); t++) {
+                        names.push_back(IlpUtils::varName("bs", {operation.getIndex(), t}));
+                    }
+                }
             }
+
+            int first = mMasterModel->addVars(numVars, 0, 1, MilpVarType::BINARY, scfg.mVariableNames ? &names : nullptr);
+            iota(mMasterVars.bs.data(), mMasterVars.bs.data() + numVars, first);
         }
 
         if (scfg.mNoEnergyConsumptionLimits == false) {
             int tMin = mMasterVars.getAllocMin();
             int tMax = mMasterVars.getAllocMax();
+            int numVars = max(0, tMax - tMin + 1);
+            vector<string> names;
+            if (scfg.mVariableNames) {
+                for (int t = tMin; t <= tMax; t++) {
+                    names.push_back(IlpUtils::varName("e", {t}));
+                }
+            }
+
+            int first = mMasterModel->addVars(numVars, 0, infinity, MilpVarType::CONTINUOUS,
+                                              scfg.mVariableNames ? &names : nullptr);
             for (int t = tMin; t <= tMax; t++) {
-                mMasterVars.eTime(t) = mMasterModel->addVar(0, GRB_INFINITY, 0, GRB_CONTINUOUS, IlpUtils::varName("e", {t}));
+                mMasterVars.eTime(t) = first + t - tMin;
             }
         }
     }
 
     void LazyConstraints::createConstraintsMasterModel(const Solver::Config &cfg, const LazyConstraints::Config &scfg) {
+        IlpConstraintBatch batch;
 
         // Each operation starts at some time.
+        // Variables of an operation are contiguous in bs, so each row is a single slice.
         for (const Operation *pOperation : mIns.getOperations()) {
             const Operation &operation = *pOperation;
 
-            GRBLinExpr expr = 0;
             int tMin = mMasterVars.getStartTimeMin(operation);
             int tMax = mMasterVars.getStartTimeMax(operation);
-            for (int t = tMin; t <= tMax; t++) {
-                expr += mMasterVars.bs(operation.getIndex(), t);
-            }
-            mMasterModel->addConstr(expr == 1);
+            batch.addTerms(&mMasterVars.bs(operation.getIndex(), tMin), 1.0, tMax - tMin + 1);
+            batch.endRow(MilpSense::EQUAL, 1);
         }
 
         // No overlapping of operations.
         // Modeled as SOS of type 1.
         {
+            vector<int> vars;
+            vector<double> weights;
+
             int tMin = mMasterVars.getAllocMin();
             int tMax = mMasterVars.getAllocMax();
             for (int t = tMin; t <= tMax; t++) {
-                vector<GRBVar> vars;
-                vector<double> weights;
+                vars.clear();
 
                 for (const Operation *pOperation : mIns.getOperations()) {
                     const Operation &operation = *pOperation;
 
                     int tpMin = max(mMasterVars.getStartTimeMin(operation), t - operation.getProcessingTime() + 1);
                     int tpMax = min(t, mMasterVars.getStartTimeMax(operation));
-                    for (int tp = tpMin; tp <= tpMax; tp++) {
-                        vars.push_back(mMasterVars.bs(operation.getIndex(), tp));
-                        weights.push_back(1.0);
+                    if (tpMin <= tpMax) {
+                        const int *slice = &mMasterVars.bs(operation.getIndex(), tpMin);
+                        vars.insert(vars.end(), slice, slice + (tpMax - tpMin + 1));
                     }
                 }
 
                 if (vars.size() != 0) {
-                    mMasterModel->addSOS(&vars[0], &weights[0], (int)vars.size(), GRB_SOS_TYPE1);
+                    weights.resize(vars.size(), 1.0);
+                    mMasterModel->addSos1(vars.data(), weights.data(), (int)vars.size());
                 }
             }
         }
@@ -573,20 +901,20 @@ namespace rseclp {
                 int tMin = mMasterVars.getAllocMin();
                 int tMax = mMasterVars.getAllocMax();
                 for (int t = tMin; t <= tMax; t++) {
-                    GRBLinExpr expr = 0;
-
                     for (const Operation *pOperation : mIns.getOperations()) {
                         const Operation &operation = *pOperation;
 
                         int tpMin = max(mMasterVars.getStartTimeMin(operation), t - operation.getProcessingTime() + 1);
                         int tpMax = min(t, mMasterVars.getStartTimeMax(operation));
-                        for (int tp = tpMin; tp <= tpMax; tp++) {
-                            expr += mMasterVars.bs(operation.getIndex(), tp) * operation.getPowerConsumption();
+                        if (tpMin <= tpMax) {
+                            batch.addTerms(&mMasterVars.bs(operation.getIndex(), tpMin),
+                                           operation.getPowerConsumption(),
+                                           tpMax - tpMin + 1);
                         }
-
                     }
 
-                    mMasterModel->addConstr(expr == mMasterVars.eTime(t));
+                    batch.addTerm(mMasterVars.eTime(t), -1.0);
+                    batch.endRow(MilpSense::EQUAL, 0);
                 }
             }
 
@@ -594,15 +922,13 @@ namespace rseclp {
             for (const MeteringInterval *pMeteringInterval : mIns.getMeteringIntervals()) {
                 const MeteringInterval &meteringInterval = *pMeteringInterval;
 
-                GRBLinExpr expr = 0;
-
                 int tMin = max(meteringInterval.getStart(), mMasterVars.getAllocMin());
                 int tMax = min(meteringInterval.getEnd() - 1, mMasterVars.getAllocMax());
                 for (int t = tMin; t <= tMax; t++) {
-                    expr += mMasterVars.eTime(t);
+                    batch.addTerm(mMasterVars.eTime(t), 1.0);
                 }
 
-                mMasterModel->addConstr(expr <= meteringInterval.getMaxEnergyConsumption());
+                batch.endRow(MilpSense::LESS_EQUAL, meteringInterval.getMaxEnergyConsumption());
             }
         }
 
@@ -612,34 +938,35 @@ namespace rseclp {
                 const MeteringInterval &meteringInterval = *pMeteringInterval;
 
                 for (int deviation = 1; deviation <= mIns.getMaxDeviation(); deviation++) {
-                    GRBLinExpr expr = 0;
                     for (int tRel = 0; tRel < mIns.getLengthMeteringInterval(); tRel++) {
                         int t = meteringInterval.getStart() - deviation + tRel;
                         if (mMasterVars.getAllocMin() <= t && t <= mMasterVars.getAllocMax()) {
-                            expr += mMasterVars.eTime(t);
+                            batch.addTerm(mMasterVars.eTime(t), 1.0);
                         }
                     }
 
-                    mMasterModel->addConstr(expr <= meteringInterval.getMaxEnergyConsumption());
+                    batch.endRow(MilpSense::LESS_EQUAL, meteringInterval.getMaxEnergyConsumption());
                 }
             }
         }
 
         switch (cfg.getObjective()->getType()) {
             case Objective::Type::TOTAL_TARDINESS: {
-                GRBLinExpr expr = 0;
+                batch.addTerm(mMasterVars.z, 1.0);
                 for (const Operation *pOperation : mIns.getOperations()) {
                     const Operation &operation = *pOperation;
 
                     int tMin = mMasterVars.getStartTimeMin(operation);
                     int tMax = mMasterVars.getStartTimeMax(operation);
                     for (int t = tMin; t <= tMax; t++) {
-                        expr += max(0,
-                                    (t + operation.getProcessingTime() - operation.getDueDate())) * mMasterVars.bs(operation.getIndex(), t);
+                        int tardiness = max(0, t + operation.getProcessingTime() - operation.getDueDate());
+                        if (tardiness > 0) {
+                            batch.addTerm(mMasterVars.bs(operation.getIndex(), t), -tardiness);
+                        }
                     }
                 }
 
-                mMasterModel->addConstr(mMasterVars.z == expr);
+                batch.endRow(MilpSense::EQUAL, 0);
             }
             break;
 
@@ -647,13 +974,17 @@ namespace rseclp {
                 assert(false);
                 break;
         }
+
+        batch.addTo(*mMasterModel);
     }
 
     void LazyConstraints::createObjectiveMasterModel(const Solver::Config &cfg, const LazyConstraints::Config &/*scfg*/) {
         switch (cfg.getObjective()->getType()) {
             case Objective::Type::TOTAL_TARDINESS:
             {
-                mMasterModel->setObjective(mMasterVars.z + 0, GRB_MINIMIZE);
+                MilpLinExpr expr;
+                expr.addTerm(mMasterVars.z, 1.0);
+                mMasterModel->setObjective(expr, true);
             }
             break;
 
@@ -663,21 +994,48 @@ namespace rseclp {
         }
     }
 
+    int LazyConstraints::reinjectPooledCuts(const LazyConstraints::Config &scfg) {
+        // Cuts learned by previous solves are valid for the whole search, so they are added as ordinary constraints.
+        IlpConstraintBatch batch;
+        for (auto &cut : CutPool::load(scfg.mCutPoolPath, mIns)) {
+            batch.addRow(createCutExpr(cut), MilpSense::LESS_EQUAL, cut.mRhs);
+        }
+
+        int numCuts = batch.size();
+        batch.addTo(*mMasterModel);
+        return numCuts;
+    }
+
+    MilpLinExpr LazyConstraints::createCutExpr(const CutPool::Cut &cut) const {
+        MilpLinExpr expr;
+        for (auto &term : cut.mTerms) {
+            // Terms outside the start time windows have no variables.
+            const Operation &operation = *mIns.getOperation(term.mOperationIndex);
+            const int tMin = max(term.mStart, mMasterVars.getStartTimeMin(operation));
+            const int tMax = min(term.mEnd - 1, mMasterVars.getStartTimeMax(operation));
+            if (tMin <= tMax) {
+                expr.addTerms(&mMasterVars.bs(operation.getIndex(), tMin), 1.0, tMax - tMin + 1);
+            }
+        }
+        return expr;
+    }
+
     StartTimes LazyConstraints::getStartTimesFromMasterSolution() const {
         StartTimes startTimes(mIns.getNumOperations());
-        MultiArray<int> startTimesBinary = IlpUtils::binaryVariablesToValues(mMasterVars.bs);
 
+        auto values = mMasterModel->getValues(mMasterVars.bs.backingArray().data(), mMasterVars.bs.size());
+        int index = 0;
         for (const Operation *pOperation : mIns.getOperations()) {
             const Operation &operation = *pOperation;
 
             int tMin = mMasterVars.getStartTimeMin(operation);
             int tMax = mMasterVars.getStartTimeMax(operation);
-            for (int t = tMin; t <= tMax; t++) {
-                if (startTimesBinary(operation.getIndex(), t) == 1) {
+            for (int t = tMax; t >= tMin; t--) {
+                if (values[index + t - tMin] >= 0.5) {
                     startTimes[operation] = t;
-                    break;
                 }
             }
+            index += max(0, tMax - tMin + 1);
         }
 
         return startTimes;
@@ -26,10 +26,13 @@
 #ifndef ROBUSTENERGYAWARESCHEDULING_LAZYCONSTRAINTS_H
 #define ROBUSTENERGYAWARESCHEDULING_LAZYCONSTRAINTS_H
 
-#include <gurobi_c++.h>
 #include <cassert>
+#include <map>
 #include "../Solver.h"
 #include "../../utils/MultiArray.h"
+#include "../../utils/WindowArray.h"
+#include "../../milp/MilpEnvironment.h"
+#include "CutPool.h"
 
 namespace rseclp {
 
@@ -38,7 +41,7 @@ namespace rseclp {
     public:
         static const string KEY_SOLVER;
 
-        LazyConstraints(const Instance &ins, GRBEnv &env);
+        LazyConstraints(const Instance &ins, MilpEnvironment &env);
 
         class Config {
         public:
@@ -47,12 +50,27 @@ namespace rseclp {
             static const string KEY_GENERATE_CUTTING_CONSTRAINTS_ETFA2016;
             static const string KEY_NO_ENERGY_CONSUMPTION_LIMITS;
             static const string KEY_NO_DEVIATIONS;
+            static const string KEY_TIGHT_START_TIME_WINDOWS;
+            static const string KEY_VARIABLE_NAMES;
+            static const string KEY_CUT_POOL_PATH;
+            static const string KEY_PARALLEL_SEPARATION;
+            static const string KEY_NODE_HEURISTIC;
 
             const bool mGenerateCuttingConstraintsOneSolution;
             const bool mGenerateCuttingConstraintsTowardsOptimal;
             const bool mGenerateCuttingConstraintsETFA2016;
             const bool mNoEnergyConsumptionLimits;
             const bool mNoDeviations;
+            const bool mTightStartTimeWindows;
+            // Naming the variables is useful only for debugging (e.g. writing the model), otherwise it is skipped.
+            const bool mVariableNames;
+            // Cuts valid for the instance are loaded from the pool before the solve and the generated ones are saved
+            // after it. Empty path disables the pool.
+            const string mCutPoolPath;
+            // Enabled separators run concurrently for every solution found.
+            const bool mParallelSeparation;
+            // Robust schedules derived from the node relaxations are submitted as heuristic solutions.
+            const bool mNodeHeuristic;
 
             const bool mNoCallback;
 
@@ -60,7 +78,12 @@ namespace rseclp {
                    bool generateCuttingConstraintsTowardsOptimal,
                    bool generateCuttingConstraintsETFA2016,
                    bool noEnergyConsumptionLimits,
-                   bool noDeviations);
+                   bool noDeviations,
+                   bool tightStartTimeWindows,
+                   bool variableNames,
+                   string cutPoolPath,
+                   bool parallelSeparation,
+                   bool nodeHeuristic);
 
             static Config createFrom(const Solver::Config &cfg);
         };
@@ -69,21 +92,27 @@ namespace rseclp {
 
     private:
         const Instance &mIns;
-        GRBEnv &mEnv;
-        unique_ptr<GRBModel> mMasterModel;
+        MilpEnvironment &mEnv;
+        unique_ptr<MilpModel> mMasterModel;
 
         class Vars {
         private:
             const LazyConstraints &mSuper;
-            int mMinReleaseTime;
+            vector<int> mStartTimeMins;
+            vector<int> mStartTimeMaxs;
+            int mAllocMin;
+            int mAllocMax;
 
         public:
-            GRBVar z;
-            MultiArray<GRBVar> bs;
-            MultiArray<GRBVar> eTime;
+            int z;
+            // Variables exist only inside the start time window of each operation.
+            WindowArray<int> bs;
+            MultiArray<int> eTime;
 
             Vars(const LazyConstraints &super);
 
+            void setStartTimeWindows(const vector<int> &startTimeMins, const vector<int> &startTimeMaxs);
+
             int getStartTimeMin(const Operation &operation) const;
 
             int getStartTimeMax(const Operation &operation) const;
@@ -94,42 +123,70 @@ namespace rseclp {
 
         } mMasterVars;
 
-        class Callback : public GRBCallback {
+        class Callback : public MilpCallback {
         public:
             LazyConstraints &mSuper;
+            const Solver::Config &mCfg;
             LazyConstraints::Config mScfg;
 
             int mNumGeneratedLazyConstraints = 0;
+            int mNumNodeHeuristicSolutions = 0;
+            vector<CutPool::Cut> mGeneratedCuts;
+            // Cuts of already separated solutions, keyed by their start times.
+            map<vector<int>, vector<CutPool::Cut>> mSeparatedCuts;
+            vector<int> mLastNodeHeuristicOrder;
+            // Bound last published during the search.
+            double mPublishedBound;
 
-            Callback(LazyConstraints &super, LazyConstraints::Config scfg);
+            Callback(LazyConstraints &super, const Solver::Config &cfg, LazyConstraints::Config scfg);
 
-        protected:
-            virtual void callback();
+            virtual void onEvent(const MilpCallback::Event event, MilpCallbackContext &context);
 
         private:
-            StartTimes getStartTimes();
+            StartTimes getStartTimes(MilpCallbackContext &context);
+
+            vector<CutPool::Cut> separate(const StartTimes &startTimes) const;
 
-            void generateCuttingConstraintsOneSolution(const StartTimes &startTimes);
+            template <typename Alg>
+            void runNodeHeuristic(MilpCallbackContext &context);
 
-            void generateCuttingConstraintsTowardsOptimal(const StartTimes &startTimes);
+            void generateCuttingConstraintsOneSolution(const StartTimes &startTimes, vector<CutPool::Cut> &cuts) const;
 
-            void generateCuttingConstraintsETFA2016(const StartTimes &startTimes);
+            template <typename Alg>
+            void generateCuttingConstraintsTowardsOptimal(const StartTimes &startTimes, vector<CutPool::Cut> &cuts) const;
 
-            void generateCuttingConstraints(const vector<const Operation*> ordered,
-                                            const vector<Interval<int>> cuttingIntervals);
+            void generateCuttingConstraintsETFA2016(const StartTimes &startTimes, vector<CutPool::Cut> &cuts) const;
 
-            void generateCuttingConstraints(const vector<Interval<int>> cuttingIntervals);
+            CutPool::Cut createCut(const vector<const Operation*> ordered,
+                                   const vector<Interval<int>> cuttingIntervals,
+                                   CutPool::CutType type) const;
 
-            void generateCuttingConstraint(const Operation &operation,
-                                           const Interval<int> &cuttingInterval,
-                                           GRBLinExpr &expr);
+            CutPool::Cut createCut(const vector<Interval<int>> cuttingIntervals, CutPool::CutType type) const;
+
+            void addCut(const CutPool::Cut &cut, MilpCallbackContext &context);
         };
 
         friend class Callback;
 
         StartTimes getStartTimesFromMasterSolution() const;
 
-        void setInitialSolution(const Solver::Config &cfg);
+        MilpLinExpr createCutExpr(const CutPool::Cut &cut) const;
+
+        int reinjectPooledCuts(const LazyConstraints::Config &scfg);
+
+        template <typename Alg>
+        bool findInitialSolution(const Solver::Config &cfg,
+                                 const LazyConstraints::Config &scfg,
+                                 StartTimes &initStartTimes,
+                                 double &initObjVal) const;
+
+        template <typename Alg>
+        void computeStartTimeWindows(const Solver::Config &cfg,
+                                     const LazyConstraints::Config &scfg,
+                                     bool hasUpperBound,
+                                     double upperBound);
+
+        void setInitialSolution(const StartTimes &initStartTimes);
 
         void createVariablesMasterModel(const Solver::Config &cfg, const LazyConstraints::Config &scfg);
 
@@ -0,0 +1,159 @@
+/*
+    
+    Copyright (C) 2017 Czech Technical University in Prague
+    The MIT License (MIT)
+    
+    Permission is hereby granted, free of charge, to any person obtaining
+    a copy of this software and associated documentation files
+    (the "Software"), to deal in the Software without restriction,
+    including without limitation the rights to use, copy, modify, merge,
+    publish, distribute, sublicense, and/or sell copies of the Software,
+    and to permit persons to whom the Software is furnished to do so,
+    subject to the following conditions:
+    
+    The above copyright notice and this permission notice shall be
+    included in all copies or substantial portions of the Software.
+    
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+    EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+    MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+    IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+    CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+    TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+    SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+#ifndef ROBUSTENERGYAWARESCHEDULING_BATCHFIXEDORDEREVALUATOR_H
+#define ROBUSTENERGYAWARESCHEDULING_BATCHFIXEDORDEREVALUATOR_H
+
+#include <algorithm>
+#include <numeric>
+#include "../../instance/Instance.h"
+#include "../../objectives/Objective.h"
+#include "../../utils/StartTimes.h"
+#include "RobustScheduleFixedOrder.h"
+
+namespace rseclp {
+    using namespace std;
+
+    // Evaluates a batch of orders of the same instance by one engine. The orders are evaluated in lexicographic
+    // order, so that the robust start times of the prefix shared with the previously evaluated order are reused
+    // (the engine does not change the start times of the prefix when appending). Results are stored in flat arrays
+    // indexed by the order and the buffers are reused between the batches.
+    template <typename Alg>
+    class BatchFixedOrderEvaluator {
+    private:
+        const Instance &mIns;
+        const Objective &mObj;
+        const int mNumOperations;
+        Alg mAlg;
+
+        int mNumOrders;
+        // Row k holds the operation indices of order k.
+        vector<int> mOrderedOperationIndices;
+        vector<int> mEvaluationOrder;
+
+        vector<char> mFeasible;
+        // Row k holds the start times of order k indexed by the operation.
+        vector<int> mStartTimes;
+        vector<double> mObjectiveValues;
+
+        // Order currently in the engine and the number of its positions with valid start times.
+        vector<const Operation*> mOrdered;
+        int mValidPrefixLength;
+
+        const int *row(const vector<int> &array, const int order) const {
+            return array.data() + (size_t)order * mNumOperations;
+        }
+
+    public:
+        BatchFixedOrderEvaluator(const Instance &ins, const Objective &obj)
+                : mIns(ins),
+                  mObj(obj),
+                  mNumOperations(ins.getNumOperations()),
+                  mAlg(ins),
+                  mNumOrders(0),
+                  mOrdered(ins.getNumOperations(), nullptr),
+                  mValidPrefixLength(0) { }
+
+        void clear() {
+            mNumOrders = 0;
+            mOrderedOperationIndices.clear();
+        }
+
+        int addOrder(const vector<const Operation*> &ordered) {
+            for (auto *pOperation : ordered) {
+                mOrderedOperationIndices.push_back(pOperation->getIndex());
+            }
+            return mNumOrders++;
+        }
+
+        int getNumOrders() const {
+            return mNumOrders;
+        }
+
+        void evaluate() {
+            mEvaluationOrder.resize(mNumOrders);
+            iota(mEvaluationOrder.begin(), mEvaluationOrder.end(), 0);
+            sort(mEvaluationOrder.begin(), mEvaluationOrder.end(), [this](const int lhs, const int rhs) {
+                const int *lhsRow = row(mOrderedOperationIndices, lhs);
+                const int *rhsRow = row(mOrderedOperationIndices, rhs);
+                return lexicographical_compare(lhsRow, lhsRow + mNumOperations, rhsRow, rhsRow + mNumOperations);
+            });
+
+            mFeasible.resize(mNumOrders);
+            mStartTimes.resize((size_t)mNumOrders * mNumOperations);
+            mObjectiveValues.resize(mNumOrders);
+
+            for (int order : mEvaluationOrder) {
+                const int *orderedOperationIndices = row(mOrderedOperationIndices, order);
+
+                int position = 0;
+                while (position < mValidPrefixLength
+                       && mOrdered[position]->getIndex() == orderedOperationIndices[position]) {
+                    position++;
+                }
+                for (int fillPosition = position; fillPosition < mNumOperations; fillPosition++) {
+                    mOrdered[fillPosition] = mIns.getOperation(orderedOperationIndices[fillPosition]);
+                }
+
+                bool isFeasible = true;
+                for (; position < mNumOperations; position++) {
+                    if (mAlg.appendPosition(mOrdered, position) == FeasibilityResult::INFEASIBLE) {
+                        isFeasible = false;
+                        break;
+                    }
+                }
+                mValidPrefixLength = position;
+
+                auto &startTimes = mAlg.getStartTimes();
+                copy(startTimes.getBackingArray().begin(),
+                     startTimes.getBackingArray().end(),
+                     mStartTimes.begin() + (size_t)order * mNumOperations);
+                mFeasible[order] = isFeasible;
+                mObjectiveValues[order] = isFeasible ? mObj.compute(mIns, startTimes) : mObj.worstValue();
+            }
+        }
+
+        bool isFeasible(const int order) const {
+            return mFeasible[order] != 0;
+        }
+
+        double getObjectiveValue(const int order) const {
+            return mObjectiveValues[order];
+        }
+
+        StartTimes getStartTimes(const int order) const {
+            const int *startTimes = row(mStartTimes, order);
+            return StartTimes(vector<int>(startTimes, startTimes + mNumOperations));
+        }
+
+        vector<const Operation*> getOrdered(const int order) const {
+            const int *orderedOperationIndices = row(mOrderedOperationIndices, order);
+            return mIns.getOperationsByOrder(vector<int>(orderedOperationIndices, orderedOperationIndices + mNumOperations));
+        }
+    };
+}
+
+
+#endif //ROBUSTENERGYAWARESCHEDULING_BATCHFIXEDORDEREVALUATOR_H
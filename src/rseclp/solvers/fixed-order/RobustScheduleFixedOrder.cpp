@@ -30,22 +30,33 @@
 
 namespace rseclp {
 
+    const string RobustScheduleFixedOrder::ENGINE_2016B = "2016B";
+    const string RobustScheduleFixedOrder::ENGINE_OPTIMISED = "optimised";
+
     RobustScheduleFixedOrder::RobustScheduleFixedOrder(const Instance &ins)
             : mIns(ins) { }
 
+    RobustScheduleFixedOrder::~RobustScheduleFixedOrder() { }
+
+    FixedOrderEngine RobustScheduleFixedOrder::engineFromName(const string &name) {
+        if (name == ENGINE_2016B) {
+            return FixedOrderEngine::FIXED_ORDER_2016B;
+        }
+        else if (name == ENGINE_OPTIMISED) {
+            return FixedOrderEngine::FIXED_ORDER_OPTIMISED;
+        }
+        else {
+            cout << "Unknown fixed order engine " << name << endl;
+            exit(1);
+        }
+    }
+
     FeasibilityResult RobustScheduleFixedOrder::create(const vector<const Operation*> &ordered) {
         return create(ordered, mIns.getNumOperations() - 1);
     }
 
     FeasibilityResult RobustScheduleFixedOrder::create(const vector<const Operation*> &ordered, const int upToPosition) {
-        for (int position = 0; position <= upToPosition; position++) {
-            auto feasibilityResult = appendPosition(ordered, position);
-            if (feasibilityResult == FeasibilityResult::INFEASIBLE) {
-                return FeasibilityResult::INFEASIBLE;
-            }
-        }
-
-        return FeasibilityResult::FEASIBLE;
+        return createUpTo(*this, ordered, upToPosition);
     }
 
 }
@@ -29,6 +29,7 @@
 
 #include "../../instance/Instance.h"
 #include "../../utils/StartTimes.h"
+#include "../../utils/Telemetry.h"
 #include "../../solvers/Solver.h"
 
 namespace rseclp {
@@ -40,8 +41,27 @@ namespace rseclp {
         const Instance &mIns;
 
     public:
+        static const string ENGINE_2016B;
+        static const string ENGINE_OPTIMISED;
+
         RobustScheduleFixedOrder(const Instance &ins);
 
+        virtual ~RobustScheduleFixedOrder();
+
+        static FixedOrderEngine engineFromName(const string &name);
+
+        // Appends the positions one by one, for a final Alg the calls are resolved statically.
+        template <typename Alg>
+        static FeasibilityResult createUpTo(Alg &alg, const vector<const Operation*> &ordered, const int upToPosition) {
+            for (int position = 0; position <= upToPosition; position++) {
+                if (alg.appendPosition(ordered, position) == FeasibilityResult::INFEASIBLE) {
+                    return FeasibilityResult::INFEASIBLE;
+                }
+            }
+
+            return FeasibilityResult::FEASIBLE;
+        }
+
         virtual FeasibilityResult create(const vector<const Operation*> &ordered);
 
         virtual FeasibilityResult create(const vector<const Operation*> &ordered, const int upToPosition);
@@ -49,6 +69,12 @@ namespace rseclp {
         virtual FeasibilityResult appendPosition(const vector<const Operation*> &ordered, const int position) = 0;
 
         virtual const StartTimes &getStartTimes() const = 0;
+
+        // Saves the state needed to append the position after upToPosition, i.e. the start times and the latest start
+        // times of the prefix, so that the engine can continue from it after building other orders.
+        virtual void saveCheckpoint(const vector<const Operation*> &ordered, const int upToPosition, vector<int> &checkpoint) const = 0;
+
+        virtual void restoreCheckpoint(const vector<const Operation*> &ordered, const int upToPosition, const vector<int> &checkpoint) = 0;
     };
 
 }
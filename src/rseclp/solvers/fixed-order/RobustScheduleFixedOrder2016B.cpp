@@ -27,6 +27,7 @@
 #include <iostream>
 #include "RobustScheduleFixedOrder2016B.h"
 #include "../../utils/GeneralUtils.h"
+#include "../../utils/EnergyProfile.h"
 
 namespace rseclp {
 
@@ -38,7 +39,17 @@ namespace rseclp {
               mRightShiftStartTimes(ins.getNumOperations()) {
     }
 
+    FeasibilityResult RobustScheduleFixedOrder2016B::create(const vector<const Operation*> &ordered) {
+        return createUpTo(*this, ordered, mIns.getNumOperations() - 1);
+    }
+
+    FeasibilityResult RobustScheduleFixedOrder2016B::create(const vector<const Operation*> &ordered, const int upToPosition) {
+        return createUpTo(*this, ordered, upToPosition);
+    }
+
     FeasibilityResult RobustScheduleFixedOrder2016B::appendPosition(const vector<const Operation*> &ordered, const int position) {
+        Telemetry::ScopedTimer timer(Telemetry::ENGINE_TIME);
+        Telemetry::count(Telemetry::FIXED_ORDER_APPENDS);
         const Operation &operation = *ordered[position];
         mStartTimes[operation] = operation.getReleaseTime();
 
@@ -61,7 +72,7 @@ namespace rseclp {
                                                           prevPosition,
                                                           t,
                                                           &meteringInterval);
-                int maxPossibleIntersection = (int) ((meteringInterval.getMaxEnergyConsumption() - GeneralUtils::computeEnergyConsumptionInMeteringInterval(ordered, mRightShiftStartTimes, prevPosition, meteringInterval)) / operation.getPowerConsumption());
+                int maxPossibleIntersection = (int) ((meteringInterval.getMaxEnergyConsumption() - EnergyProfile::computeEnergyConsumption(ordered, mRightShiftStartTimes, 0, prevPosition, meteringInterval)) / operation.getPowerConsumption());
                 if (operation.getProcessingTime() <= maxPossibleIntersection) {
                     t = meteringInterval.getStart() - prevOperation.getProcessingTime() - 1;
                 }
@@ -109,4 +120,23 @@ namespace rseclp {
     const StartTimes &RobustScheduleFixedOrder2016B::getStartTimes() const {
         return mStartTimes;
     }
+
+    void RobustScheduleFixedOrder2016B::saveCheckpoint(const vector<const Operation*> &ordered,
+                                                     const int upToPosition,
+                                                     vector<int> &checkpoint) const {
+        checkpoint.resize(2 * (upToPosition + 1));
+        for (int position = 0; position <= upToPosition; position++) {
+            checkpoint[2 * position] = mStartTimes[*ordered[position]];
+            checkpoint[2 * position + 1] = mLatestStartTimes[*ordered[position]];
+        }
+    }
+
+    void RobustScheduleFixedOrder2016B::restoreCheckpoint(const vector<const Operation*> &ordered,
+                                                        const int upToPosition,
+                                                        const vector<int> &checkpoint) {
+        for (int position = 0; position <= upToPosition; position++) {
+            mStartTimes[*ordered[position]] = checkpoint[2 * position];
+            mLatestStartTimes[*ordered[position]] = checkpoint[2 * position + 1];
+        }
+    }
 }
@@ -35,7 +35,7 @@
 namespace rseclp {
     using namespace std;
 
-    class RobustScheduleFixedOrder2016B : public RobustScheduleFixedOrder {
+    class RobustScheduleFixedOrder2016B final : public RobustScheduleFixedOrder {
 
     private:
         const Instance &mIns;
@@ -47,9 +47,17 @@ namespace rseclp {
     public:
         RobustScheduleFixedOrder2016B(const Instance &ins);
 
+        virtual FeasibilityResult create(const vector<const Operation*> &ordered);
+
+        virtual FeasibilityResult create(const vector<const Operation*> &ordered, const int upToPosition);
+
         virtual FeasibilityResult appendPosition(const vector<const Operation*> &ordered, const int position);
 
         virtual const StartTimes &getStartTimes() const;
+
+        virtual void saveCheckpoint(const vector<const Operation*> &ordered, const int upToPosition, vector<int> &checkpoint) const;
+
+        virtual void restoreCheckpoint(const vector<const Operation*> &ordered, const int upToPosition, const vector<int> &checkpoint);
     };
 
 }
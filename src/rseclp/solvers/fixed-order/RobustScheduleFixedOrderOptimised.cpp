@@ -27,6 +27,8 @@
 #include <iostream>
 #include "RobustScheduleFixedOrderOptimised.h"
 #include "../../utils/GeneralUtils.h"
+#include "../../utils/EnergyProfile.h"
+#include "../../utils/Profiler.h"
 
 namespace rseclp {
 
@@ -35,10 +37,24 @@ namespace rseclp {
               mIns(ins),
               mStartTimes(ins.getNumOperations()),
               mLatestStartTimes(ins.getNumOperations()),
-              mRightShiftStartTimes(ins.getNumOperations()) {
+              mRightShiftStartTimes(ins.getNumOperations()),
+              mRightShiftEnergyProfile(ins),
+              mProfileFromPosition(0),
+              mProfileToPosition(-1) {
+    }
+
+    FeasibilityResult RobustScheduleFixedOrderOptimised::create(const vector<const Operation*> &ordered) {
+        return createUpTo(*this, ordered, mIns.getNumOperations() - 1);
+    }
+
+    FeasibilityResult RobustScheduleFixedOrderOptimised::create(const vector<const Operation*> &ordered, const int upToPosition) {
+        return createUpTo(*this, ordered, upToPosition);
     }
 
     FeasibilityResult RobustScheduleFixedOrderOptimised::appendPosition(const vector<const Operation*> &ordered, const int position) {
+        Telemetry::ScopedTimer timer(Telemetry::ENGINE_TIME);
+        Telemetry::count(Telemetry::FIXED_ORDER_APPENDS);
+        RSECLP_PROFILE_SCOPE(appendScope, "appendPosition");
         const Operation &operation = *ordered[position];
 
         if (position == 0) {
@@ -65,8 +81,10 @@ namespace rseclp {
                 }
             }
 
+            RSECLP_PROFILE_SCOPE(walkBackScope, "appendPosition/walkBack");
             while (!stop) {
                 // Loop over metering intervals.
+                RSECLP_PROFILE_ITERATE(walkBackScope);
                 const MeteringInterval &meteringInterval = **itMeteringInterval;
 
                 int t = min(meteringInterval.getEnd() - prevOperation.getProcessingTime() - 1,
@@ -89,6 +107,7 @@ namespace rseclp {
                                                                                               firstIntersectingPosition,
                                                                                               meteringInterval),
                                             meteringInterval);
+                trackRightShiftPositions(ordered, firstIntersectingPosition, prevPosition);
 
                 bool continueWithPreviousMeteringInterval = false;
                 while (!stop && !continueWithPreviousMeteringInterval) {
@@ -122,6 +141,7 @@ namespace rseclp {
                     else if (firstIntersectingOperation.getPowerConsumption() >= operation.getPowerConsumption()) {
                         // firstIntersectingOperation can be completely shifted out of interval without violating
                         // energy limit.
+                        untrackFirstRightShiftPosition(ordered);
                         firstIntersectingPosition += 1;
                     }
                     else {
@@ -132,10 +152,12 @@ namespace rseclp {
                                                     mRightShiftStartTimes[firstIntersectingOperation] - 1,  // This is feasible due to previous case.
                                                     meteringInterval);
                         if ((mRightShiftStartTimes[firstIntersectingOperation] + firstIntersectingOperation.getProcessingTime()) <= meteringInterval.getStart()) {
+                            untrackFirstRightShiftPosition(ordered);
                             firstIntersectingPosition += 1;
                         }
                     }
                 }
+                untrackRightShiftPositions(ordered);
 
                 if (continueWithPreviousMeteringInterval) {
                     if (itMeteringInterval == mIns.getMeteringIntervals().cbegin()) {
@@ -149,9 +171,11 @@ namespace rseclp {
         }
 
         // Computation of start time due to only ordered[position].
+        RSECLP_PROFILE_SCOPE(adjustmentScope, "appendPosition/adjustment");
         mStartTimes.computeLatestStartTime(mIns, ordered, position, mLatestStartTimes);
         int initMeteringIntervalIndex = mStartTimes[operation] / mIns.getLengthMeteringInterval();
         for (int meteringIntervalIndex = initMeteringIntervalIndex; meteringIntervalIndex != mIns.getNumMeteringIntervals(); meteringIntervalIndex++) {
+            RSECLP_PROFILE_ITERATE(adjustmentScope);
             const MeteringInterval &meteringInterval = *mIns.getMeteringInterval(meteringIntervalIndex);
 
             int maxIntersection = (int)(meteringInterval.getMaxEnergyConsumption() / operation.getPowerConsumption());
@@ -186,16 +210,19 @@ namespace rseclp {
                                                                const int upToPosition,
                                                                const int t,
                                                                const MeteringInterval &meteringInterval) {
+        RSECLP_PROFILE_SCOPE(rightShiftScope, "computeRightShiftStartTimes");
+
         // forPosition
-        mRightShiftStartTimes[*ordered[forPosition]] = t;
+        setRightShiftStartTime(ordered, forPosition, t);
 
         // position < forPosition
         for (int position = forPosition - 1; position >= 0; position--) {
+            RSECLP_PROFILE_ITERATE(rightShiftScope);
             const Operation &operation = *ordered[position];
             const Operation &nextOperation = *ordered[position + 1];
 
-            mRightShiftStartTimes[operation] = min(mLatestStartTimes[operation],
-                                                   mRightShiftStartTimes[nextOperation] - operation.getProcessingTime());
+            setRightShiftStartTime(ordered, position, min(mLatestStartTimes[operation],
+                                                          mRightShiftStartTimes[nextOperation] - operation.getProcessingTime()));
 
             if (mRightShiftStartTimes[operation] <= meteringInterval.getStart()) {
                 break;
@@ -204,11 +231,12 @@ namespace rseclp {
 
         // forPosition < position <= upToPosition
         for (int position = forPosition + 1; position <= upToPosition; position++) {
+            RSECLP_PROFILE_ITERATE(rightShiftScope);
             const Operation &operation = *ordered[position];
             const Operation &prevOperation = *ordered[position - 1];
 
-            mRightShiftStartTimes[operation] = max(mStartTimes[operation],
-                                                   mRightShiftStartTimes[prevOperation] + prevOperation.getProcessingTime());
+            setRightShiftStartTime(ordered, position, max(mStartTimes[operation],
+                                                          mRightShiftStartTimes[prevOperation] + prevOperation.getProcessingTime()));
 
             if (meteringInterval.getEnd() <= (mRightShiftStartTimes[operation] + operation.getProcessingTime())) {
                 break;
@@ -216,11 +244,48 @@ namespace rseclp {
         }
     }
 
+    void RobustScheduleFixedOrderOptimised::setRightShiftStartTime(const vector<const Operation*> &ordered,
+                                                                   const int position,
+                                                                   const int startTime) {
+        const Operation &operation = *ordered[position];
+        if (mProfileFromPosition <= position && position <= mProfileToPosition) {
+            mRightShiftEnergyProfile.shift(operation, mRightShiftStartTimes[operation], startTime);
+        }
+        mRightShiftStartTimes[operation] = startTime;
+    }
+
+    void RobustScheduleFixedOrderOptimised::trackRightShiftPositions(const vector<const Operation*> &ordered,
+                                                                     const int fromPosition,
+                                                                     const int toPosition) {
+        for (int position = fromPosition; position <= toPosition; position++) {
+            const Operation &operation = *ordered[position];
+            mRightShiftEnergyProfile.insert(operation, mRightShiftStartTimes[operation]);
+        }
+        mProfileFromPosition = fromPosition;
+        mProfileToPosition = toPosition;
+    }
+
+    void RobustScheduleFixedOrderOptimised::untrackFirstRightShiftPosition(const vector<const Operation*> &ordered) {
+        const Operation &operation = *ordered[mProfileFromPosition];
+        mRightShiftEnergyProfile.remove(operation, mRightShiftStartTimes[operation]);
+        mProfileFromPosition++;
+    }
+
+    void RobustScheduleFixedOrderOptimised::untrackRightShiftPositions(const vector<const Operation*> &ordered) {
+        while (mProfileFromPosition <= mProfileToPosition) {
+            untrackFirstRightShiftPosition(ordered);
+        }
+        mProfileFromPosition = 0;
+        mProfileToPosition = -1;
+    }
+
     int RobustScheduleFixedOrderOptimised::findFirstIntersectingPositionInRightShiftStartTimes(const vector<const Operation*> &ordered,
                                                                                       const int upToPosition,
                                                                                       const MeteringInterval &meteringInterval) {
+        RSECLP_PROFILE_SCOPE(firstIntersectingScope, "findFirstIntersectingPositionInRightShiftStartTimes");
         int lastNonZeroIntersectingPosition = -1;
         for (int position = upToPosition; position >= 0; position--) {
+            RSECLP_PROFILE_ITERATE(firstIntersectingScope);
             const Operation &operation = *ordered[position];
 
             int startTime = mRightShiftStartTimes[operation];
@@ -260,12 +325,11 @@ namespace rseclp {
                                                                         int forPosition,
                                                                         const MeteringInterval &meteringInterval) {
         assert(forPosition > 0);
+        assert(mProfileFromPosition == firstIntersectingPosition && mProfileToPosition == forPosition - 1);
+        RSECLP_PROFILE_SCOPE(earliestStartTimeScope, "computeEarliestStartTimeDuePreceeding");
 
         const Operation &operation = *ordered[forPosition];
-        double energyConsumption = computeEnergyConsumption(ordered,
-                                                            firstIntersectingPosition,
-                                                            forPosition - 1,
-                                                            meteringInterval);
+        double energyConsumption = mRightShiftEnergyProfile.getEnergyConsumption(meteringInterval.getIndex());
         double remainingEnergyConsumption = max(0.0, meteringInterval.getMaxEnergyConsumption() - energyConsumption);
         int maxIntersection = (int)(remainingEnergyConsumption / operation.getPowerConsumption());
 
@@ -277,28 +341,26 @@ namespace rseclp {
         return earliestStartTime;
     }
 
-    double RobustScheduleFixedOrderOptimised::computeEnergyConsumption(const vector<const Operation*> &ordered,
-                                                              int firstIntersectingPosition,
-                                                              int upToPosition,
-                                                              const MeteringInterval &meteringInterval) {
-        double energyConsumption = 0.0;
-        for (int position = upToPosition; position >= firstIntersectingPosition; position--) {
-            const Operation &operation = *ordered[position];
-
-            int startTime = mRightShiftStartTimes[operation];
-            int completionTime = startTime + operation.getProcessingTime();
+    const StartTimes &RobustScheduleFixedOrderOptimised::getStartTimes() const {
+        return mStartTimes;
+    }
 
-            int intersection = GeneralUtils::computeIntervalsIntersectionLength(meteringInterval.getStart(),
-                                                                                meteringInterval.getEnd(),
-                                                                                startTime,
-                                                                                completionTime);
-            energyConsumption += operation.getPowerConsumption() * intersection;
+    void RobustScheduleFixedOrderOptimised::saveCheckpoint(const vector<const Operation*> &ordered,
+                                                         const int upToPosition,
+                                                         vector<int> &checkpoint) const {
+        checkpoint.resize(2 * (upToPosition + 1));
+        for (int position = 0; position <= upToPosition; position++) {
+            checkpoint[2 * position] = mStartTimes[*ordered[position]];
+            checkpoint[2 * position + 1] = mLatestStartTimes[*ordered[position]];
         }
-
-        return energyConsumption;
     }
 
-    const StartTimes &RobustScheduleFixedOrderOptimised::getStartTimes() const {
-        return mStartTimes;
+    void RobustScheduleFixedOrderOptimised::restoreCheckpoint(const vector<const Operation*> &ordered,
+                                                            const int upToPosition,
+                                                            const vector<int> &checkpoint) {
+        for (int position = 0; position <= upToPosition; position++) {
+            mStartTimes[*ordered[position]] = checkpoint[2 * position];
+            mLatestStartTimes[*ordered[position]] = checkpoint[2 * position + 1];
+        }
     }
 }
@@ -29,12 +29,13 @@
 
 #include "../../instance/Instance.h"
 #include "../../utils/StartTimes.h"
+#include "../../utils/EnergyProfile.h"
 #include "../../solvers/fixed-order/RobustScheduleFixedOrder.h"
 
 namespace rseclp {
     using namespace std;
 
-    class RobustScheduleFixedOrderOptimised : public RobustScheduleFixedOrder {
+    class RobustScheduleFixedOrderOptimised final : public RobustScheduleFixedOrder {
 
     private:
         const Instance &mIns;
@@ -43,6 +44,20 @@ namespace rseclp {
         StartTimes mLatestStartTimes;
         StartTimes mRightShiftStartTimes;
 
+        // Energy of the right-shifted operations at positions [mProfileFromPosition, mProfileToPosition], kept while
+        // the start time is pushed out of a metering interval, so that its energy is not summed over the operations.
+        EnergyProfile mRightShiftEnergyProfile;
+        int mProfileFromPosition;
+        int mProfileToPosition;
+
+        void setRightShiftStartTime(const vector<const Operation*> &ordered, const int position, const int startTime);
+
+        void trackRightShiftPositions(const vector<const Operation*> &ordered, const int fromPosition, const int toPosition);
+
+        void untrackFirstRightShiftPosition(const vector<const Operation*> &ordered);
+
+        void untrackRightShiftPositions(const vector<const Operation*> &ordered);
+
         void computeRightShiftStartTimes(const vector<const Operation*> &ordered,
                                          const int forPosition,
                                          const int upToPosition,
@@ -62,17 +77,20 @@ namespace rseclp {
                                                   int forPosition,
                                                   const MeteringInterval &meteringInterval);
 
-        double computeEnergyConsumption(const vector<const Operation*> &ordered,
-                                        int firstIntersectingPosition,
-                                        int upToPosition,
-                                        const MeteringInterval &meteringInterval);
-
     public:
         RobustScheduleFixedOrderOptimised(const Instance &ins);
 
+        virtual FeasibilityResult create(const vector<const Operation*> &ordered);
+
+        virtual FeasibilityResult create(const vector<const Operation*> &ordered, const int upToPosition);
+
         virtual FeasibilityResult appendPosition(const vector<const Operation*> &ordered, const int position);
 
         virtual const StartTimes &getStartTimes() const;
+
+        virtual void saveCheckpoint(const vector<const Operation*> &ordered, const int upToPosition, vector<int> &checkpoint) const;
+
+        virtual void restoreCheckpoint(const vector<const Operation*> &ordered, const int upToPosition, const vector<int> &checkpoint);
     };
 
 }
@@ -0,0 +1,262 @@
+/*
+    
+    Copyright (C) 2017 Czech Technical University in Prague
+    The MIT License (MIT)
+    
+    Permission is hereby granted, free of charge, to any person obtaining
+    a copy of this software and associated documentation files
+    (the "Software"), to deal in the Software without restriction,
+    including without limitation the rights to use, copy, modify, merge,
+    publish, distribute, sublicense, and/or sell copies of the Software,
+    and to permit persons to whom the Software is furnished to do so,
+    subject to the following conditions:
+    
+    The above copyright notice and this permission notice shall be
+    included in all copies or substantial portions of the Software.
+    
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+    EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+    MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+    IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+    CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+    TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+    SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+#include <algorithm>
+#include <atomic>
+#include <cassert>
+#include <functional>
+#include <future>
+#include <stdexcept>
+#include "BeamSearch.h"
+#include "GreedyHeuristics.h"
+#include "../../objectives/TotalTardiness.h"
+#include "../../utils/Stopwatch.h"
+#include "../../utils/Deadline.h"
+#include "../../feasibility-checkers/FeasibilityChecker.h"
+#include "../fixed-order/RobustScheduleFixedOrder2016B.h"
+#include "../fixed-order/RobustScheduleFixedOrderOptimised.h"
+
+namespace rseclp {
+    const string BeamSearch::KEY_SOLVER = "BeamSearch";
+
+    const string BeamSearch::Config::KEY_BEAM_WIDTH = "beamWidth";
+    const string BeamSearch::Config::KEY_NUM_THREADS = "numThreads";
+    const string BeamSearch::Config::KEY_RANKING = "ranking";
+
+    const string BeamSearch::Config::RANKING_LOOK_AHEAD = "look_ahead";
+    const string BeamSearch::Config::RANKING_CHU_LOWER_BOUND = "chu_lower_bound";
+
+    BeamSearch::Config::Config(const int beamWidth, const int numThreads, const string ranking)
+            : mBeamWidth(beamWidth), mNumThreads(numThreads), mRanking(ranking) {
+        if (mRanking != RANKING_LOOK_AHEAD && mRanking != RANKING_CHU_LOWER_BOUND) {
+            throw invalid_argument("Unknown beam search ranking '" + mRanking + "'.");
+        }
+    }
+
+    BeamSearch::Config BeamSearch::Config::createFrom(const Solver::Config &cfg) {
+        auto &scfg = cfg.getSpecialisedConfig();
+
+        return BeamSearch::Config(scfg.getValue<int>(KEY_SOLVER, KEY_BEAM_WIDTH, 10),
+                                  scfg.getValue<int>(KEY_SOLVER, KEY_NUM_THREADS, 1),
+                                  scfg.getValue<string>(KEY_SOLVER, KEY_RANKING, RANKING_LOOK_AHEAD));
+    }
+
+    BeamSearch::Child::Child(int parent, int operationIndex, double score, int completionTime)
+            : mParent(parent), mOperationIndex(operationIndex), mScore(score), mCompletionTime(completionTime) {}
+
+    BeamSearch::BeamSearch(const Instance &ins) : mIns(ins) {}
+
+    Solver::Result BeamSearch::solve(const Solver::Config &cfg) {
+        // Both rankings estimate total tardiness.
+        assert(cfg.getObjective()->getType() == Objective::Type::TOTAL_TARDINESS);
+
+        if (cfg.getFixedOrderEngine() == FixedOrderEngine::FIXED_ORDER_OPTIMISED) {
+            return solveWith<RobustScheduleFixedOrderOptimised>(cfg);
+        }
+
+        return solveWith<RobustScheduleFixedOrder2016B>(cfg);
+    }
+
+    template <typename Alg>
+    Solver::Result BeamSearch::solveWith(const Solver::Config &cfg) {
+        Stopwatch stopwatch;
+        stopwatch.start();
+        Deadline deadline(cfg.getTimeLimit(), cfg.getCancellationFlag());
+
+        auto scfg = BeamSearch::Config::createFrom(cfg);
+        const Objective &obj = *cfg.getObjective();
+        const int numOperations = mIns.getNumOperations();
+
+        Solver::Result result(numOperations, obj.worstValue());
+        if (cfg.getUseInitStartTimes() && FeasibilityChecker(mIns).areFeasible(cfg.getInitStartTimes())) {
+            result.setSolution(Solver::Result::Status::FEASIBLE,
+                               cfg.getInitStartTimes(),
+                               obj.compute(mIns, cfg.getInitStartTimes()));
+        }
+
+        StartTimes incumbentStartTimes;
+        double incumbentObjVal;
+        if (cfg.testAndGetBetterIncumbent(result.getObjectiveValue(), incumbentStartTimes, incumbentObjVal)) {
+            result.setSolution(Solver::Result::Status::FEASIBLE, incumbentStartTimes, incumbentObjVal);
+        }
+
+        vector<Node> beam(1);
+        beam[0].mOrdered.resize(numOperations, nullptr);
+        for (int operationIndex = 0; operationIndex < numOperations; operationIndex++) {
+            beam[0].mRemainingOperationIndices.insert(operationIndex);
+        }
+
+        // The search stops at the time limit or on cancellation, a partial order is not completed then.
+        bool isTruncated = false;
+        long numExpandedNodes = 0;
+        Telemetry::Registry *telemetry = Telemetry::getRegistry();
+
+        // Nodes are claimed by the threads one by one, each thread has its own engine restored from the checkpoints.
+        auto forEachNode = [&](const int numNodes, const function<void(Alg&, int)> &process) {
+            atomic<int> nextNode(0);
+            auto worker = [&]() {
+                Telemetry::Scope scope(telemetry);
+                Alg alg(mIns);
+                int node;
+                while ((node = nextNode++) < numNodes) {
+                    process(alg, node);
+                }
+            };
+
+            vector<future<void>> futures;
+            for (int thread = 1; thread < min(scfg.mNumThreads, numNodes); thread++) {
+                futures.push_back(async(launch::async, worker));
+            }
+            worker();
+            for (auto &future : futures) {
+                future.get();
+            }
+        };
+
+        for (int depth = 0; depth < numOperations && !beam.empty(); depth++) {
+            if (deadline.reached()) {
+                isTruncated = true;
+                beam.clear();
+                break;
+            }
+            const int beamWidth = max(1, scfg.mBeamWidth);
+
+            vector<vector<Child>> childrenOfNodes(beam.size());
+            forEachNode((int)beam.size(), [&](Alg &alg, int node) {
+                expand<Alg>(cfg, scfg, beam[node], node, depth, alg, childrenOfNodes[node]);
+            });
+            numExpandedNodes += (long)beam.size();
+            Telemetry::count(Telemetry::NODES, (long long)beam.size());
+
+            vector<Child> children;
+            for (auto &childrenOfNode : childrenOfNodes) {
+                children.insert(children.end(), childrenOfNode.begin(), childrenOfNode.end());
+            }
+
+            // Ties are broken by the completion time and then by the position in the beam, so that the result does
+            // not depend on the threads.
+            auto numKept = min((int)children.size(), beamWidth);
+            partial_sort(children.begin(), children.begin() + numKept, children.end(), [](const Child &lhs, const Child &rhs) {
+                if (lhs.mScore != rhs.mScore) {
+                    return lhs.mScore < rhs.mScore;
+                }
+                if (lhs.mCompletionTime != rhs.mCompletionTime) {
+                    return lhs.mCompletionTime < rhs.mCompletionTime;
+                }
+                if (lhs.mParent != rhs.mParent) {
+                    return lhs.mParent < rhs.mParent;
+                }
+                return lhs.mOperationIndex < rhs.mOperationIndex;
+            });
+
+            vector<Node> nextBeam;
+            for (int child = 0; child < numKept; child++) {
+                Node node = beam[children[child].mParent];
+                node.mOrdered[depth] = mIns.getOperation(children[child].mOperationIndex);
+                node.mRemainingOperationIndices.erase(children[child].mOperationIndex);
+                nextBeam.push_back(move(node));
+            }
+
+            // The kept children continue from the checkpoint of their parent, which they hold until it is replaced.
+            forEachNode((int)nextBeam.size(), [&](Alg &alg, int node) {
+                Node &child = nextBeam[node];
+                if (depth > 0) {
+                    alg.restoreCheckpoint(child.mOrdered, depth - 1, child.mCheckpoint);
+                }
+                alg.appendPosition(child.mOrdered, depth);
+                alg.saveCheckpoint(child.mOrdered, depth, child.mCheckpoint);
+            });
+            beam = move(nextBeam);
+        }
+
+        if (!beam.empty()) {
+            Alg alg(mIns);
+            alg.restoreCheckpoint(beam.front().mOrdered, numOperations - 1, beam.front().mCheckpoint);
+            double objVal = obj.compute(mIns, alg.getStartTimes());
+            if (result.getStatus() == Solver::Result::Status::NO_SOLUTION
+                || obj.isBetter(objVal, result.getObjectiveValue())) {
+                result.setSolution(Solver::Result::Status::FEASIBLE, alg.getStartTimes(), objVal);
+                cfg.publishIncumbent(alg.getStartTimes(), objVal);
+            }
+        }
+
+        result.setOptional("numExpandedNodes", to_string(numExpandedNodes));
+        result.setOptional("truncated", isTruncated ? "1" : "0");
+
+        stopwatch.stop();
+        result.setSolverRuntime(stopwatch.duration());
+        return result;
+    }
+
+    template <typename Alg>
+    void BeamSearch::expand(const Solver::Config &cfg,
+                            const BeamSearch::Config &scfg,
+                            const BeamSearch::Node &node,
+                            const int parent,
+                            const int depth,
+                            Alg &alg,
+                            vector<BeamSearch::Child> &children) const {
+        const TotalTardiness &obj = (const TotalTardiness&) *cfg.getObjective();
+        if (depth > 0) {
+            alg.restoreCheckpoint(node.mOrdered, depth - 1, node.mCheckpoint);
+        }
+
+        // The look-ahead scores the candidates like the greedy tardiness rule, on top of the tardiness of the prefix.
+        const bool useLookAhead = scfg.mRanking == BeamSearch::Config::RANKING_LOOK_AHEAD;
+        double prefixObjVal = 0.0;
+        GreedyHeuristics::TardinessLookAhead lookAhead(mIns);
+        if (useLookAhead) {
+            prefixObjVal = depth > 0 ? obj.compute(mIns, alg.getStartTimes(), node.mOrdered, depth - 1) : 0.0;
+            for (int position = 0; position < depth; position++) {
+                lookAhead.remove(*node.mOrdered[position]);
+            }
+        }
+
+        vector<const Operation*> ordered(node.mOrdered);
+        set<int> remainingOperationIndices(node.mRemainingOperationIndices);
+        for (int operationIndex : node.mRemainingOperationIndices) {
+            const Operation *pOperation = mIns.getOperation(operationIndex);
+            ordered[depth] = pOperation;
+            if (alg.appendPosition(ordered, depth) == FeasibilityResult::INFEASIBLE) {
+                continue;
+            }
+
+            int completionTime = alg.getStartTimes()[*pOperation] + pOperation->getProcessingTime();
+            double score;
+            if (useLookAhead) {
+                score = prefixObjVal + (double)(max(0, completionTime - pOperation->getDueDate())
+                                                + lookAhead.compute(completionTime)
+                                                - GreedyHeuristics::TardinessLookAhead::computeTardiness(*pOperation, completionTime));
+            }
+            else {
+                remainingOperationIndices.erase(operationIndex);
+                score = obj.computeLowerBoundChu(mIns, ordered, alg.getStartTimes(), remainingOperationIndices);
+                remainingOperationIndices.insert(operationIndex);
+            }
+
+            children.emplace_back(parent, operationIndex, score, completionTime);
+        }
+    }
+}
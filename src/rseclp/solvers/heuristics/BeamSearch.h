@@ -0,0 +1,96 @@
+/*
+    
+    Copyright (C) 2017 Czech Technical University in Prague
+    The MIT License (MIT)
+    
+    Permission is hereby granted, free of charge, to any person obtaining
+    a copy of this software and associated documentation files
+    (the "Software"), to deal in the Software without restriction,
+    including without limitation the rights to use, copy, modify, merge,
+    publish, distribute, sublicense, and/or sell copies of the Software,
+    and to permit persons to whom the Software is furnished to do so,
+    subject to the following conditions:
+    
+    The above copyright notice and this permission notice shall be
+    included in all copies or substantial portions of the Software.
+    
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+    EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+    MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+    IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+    CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+    TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+    SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+#ifndef ROBUSTENERGYAWARESCHEDULING_BEAMSEARCH_H
+#define ROBUSTENERGYAWARESCHEDULING_BEAMSEARCH_H
+
+#include <set>
+#include "../../instance/Instance.h"
+#include "../Solver.h"
+
+namespace rseclp {
+    using namespace std;
+
+    // Beam search over the orders: every depth keeps the beamWidth best partial orders ranked by the tardiness of
+    // the prefix plus an estimate for the remaining operations, either the look-ahead of the greedy tardiness rule or
+    // the Chu lower bound.
+    class BeamSearch : public Solver {
+    public:
+        static const string KEY_SOLVER;
+
+        class Config {
+        public:
+            static const string KEY_BEAM_WIDTH;
+            static const string KEY_NUM_THREADS;
+            static const string KEY_RANKING;
+
+            static const string RANKING_LOOK_AHEAD;
+            static const string RANKING_CHU_LOWER_BOUND;
+
+            const int mBeamWidth;
+            const int mNumThreads;
+            const string mRanking;
+
+            Config(const int beamWidth, const int numThreads, const string ranking);
+
+            static Config createFrom(const Solver::Config &cfg);
+        };
+
+        BeamSearch(const Instance &ins);
+
+        virtual Solver::Result solve(const Solver::Config &cfg);
+
+    private:
+        class Node {
+        public:
+            vector<const Operation*> mOrdered;
+            set<int> mRemainingOperationIndices;
+            // Engine state after the prefix of the node.
+            vector<int> mCheckpoint;
+        };
+
+        class Child {
+        public:
+            int mParent;
+            int mOperationIndex;
+            double mScore;
+            int mCompletionTime;
+
+            Child(int parent, int operationIndex, double score, int completionTime);
+        };
+
+        const Instance &mIns;
+
+        template <typename Alg>
+        Solver::Result solveWith(const Solver::Config &cfg);
+
+        // Children of the node are appended to the children, the engine is restored from the checkpoint of the node.
+        template <typename Alg>
+        void expand(const Solver::Config &cfg, const Config &scfg, const Node &node, const int parent, const int depth, Alg &alg, vector<Child> &children) const;
+    };
+}
+
+
+#endif //ROBUSTENERGYAWARESCHEDULING_BEAMSEARCH_H
@@ -0,0 +1,273 @@
+/*
+    
+    Copyright (C) 2017 Czech Technical University in Prague
+    The MIT License (MIT)
+    
+    Permission is hereby granted, free of charge, to any person obtaining
+    a copy of this software and associated documentation files
+    (the "Software"), to deal in the Software without restriction,
+    including without limitation the rights to use, copy, modify, merge,
+    publish, distribute, sublicense, and/or sell copies of the Software,
+    and to permit persons to whom the Software is furnished to do so,
+    subject to the following conditions:
+    
+    The above copyright notice and this permission notice shall be
+    included in all copies or substantial portions of the Software.
+    
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+    EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+    MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+    IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+    CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+    TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+    SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+#include <algorithm>
+#include <atomic>
+#include <future>
+#include <set>
+#include <tuple>
+#include "Grasp.h"
+#include "GreedyHeuristics.h"
+#include "../../utils/Stopwatch.h"
+#include "../../utils/GeneralUtils.h"
+#include "../fixed-order/RobustScheduleFixedOrder2016B.h"
+#include "../fixed-order/RobustScheduleFixedOrderOptimised.h"
+
+namespace rseclp {
+    const string Grasp::KEY_SOLVER = "Grasp";
+
+    const string Grasp::Config::KEY_ALPHA = "alpha";
+    const string Grasp::Config::KEY_NUM_ITERATIONS = "numIterations";
+    const string Grasp::Config::KEY_NUM_THREADS = "numThreads";
+    const string Grasp::Config::KEY_SEED = "seed";
+    const string Grasp::Config::KEY_ELITE_SIZE = "eliteSize";
+
+    Grasp::Config::Config(const double alpha,
+                          const int numIterations,
+                          const int numThreads,
+                          const int seed,
+                          const int eliteSize)
+            : mAlpha(alpha),
+              mNumIterations(numIterations),
+              mNumThreads(numThreads),
+              mSeed(seed),
+              mEliteSize(eliteSize) {}
+
+    Grasp::Config Grasp::Config::createFrom(const Solver::Config &cfg) {
+        auto &scfg = cfg.getSpecialisedConfig();
+
+        return Grasp::Config(scfg.getValue<double>(KEY_SOLVER, KEY_ALPHA, 0.05),
+                             scfg.getValue<int>(KEY_SOLVER, KEY_NUM_ITERATIONS, 100),
+                             scfg.getValue<int>(KEY_SOLVER, KEY_NUM_THREADS, 1),
+                             scfg.getValue<int>(KEY_SOLVER, KEY_SEED, 42),
+                             scfg.getValue<int>(KEY_SOLVER, KEY_ELITE_SIZE, 5));
+    }
+
+    Grasp::Solution::Solution() : mIsFeasible(false), mObjectiveValue(numeric_limits<double>::max()), mIteration(-1) {}
+
+    Grasp::Grasp(const Instance &ins) : mIns(ins) {}
+
+    Solver::Result Grasp::solve(const Solver::Config &cfg) {
+        if (cfg.getFixedOrderEngine() == FixedOrderEngine::FIXED_ORDER_OPTIMISED) {
+            return solveWith<RobustScheduleFixedOrderOptimised>(cfg);
+        }
+
+        return solveWith<RobustScheduleFixedOrder2016B>(cfg);
+    }
+
+    const vector<Grasp::Solution> &Grasp::getEliteSet() const {
+        return mEliteSet;
+    }
+
+    template <typename Alg>
+    Solver::Result Grasp::solveWith(const Solver::Config &cfg) {
+        Stopwatch stopwatch;
+        stopwatch.start();
+
+        auto scfg = Grasp::Config::createFrom(cfg);
+        const Objective &obj = *cfg.getObjective();
+
+        // Iterations are claimed by the threads one by one, each thread has its own engine and deadline.
+        vector<Solution> solutions(max(0, scfg.mNumIterations));
+        atomic<int> nextIteration(0);
+        Telemetry::Registry *telemetry = Telemetry::getRegistry();
+        auto worker = [&]() {
+            Telemetry::Scope scope(telemetry);
+            Deadline deadline(cfg.getTimeLimit(), cfg.getCancellationFlag());
+            int iteration;
+            while ((iteration = nextIteration++) < scfg.mNumIterations && !deadline.reached()) {
+                solutions[iteration] = construct<Alg>(cfg, scfg, iteration);
+            }
+        };
+
+        vector<future<void>> futures;
+        for (int thread = 1; thread < min(scfg.mNumThreads, scfg.mNumIterations); thread++) {
+            futures.push_back(async(launch::async, worker));
+        }
+        worker();
+        for (auto &future : futures) {
+            future.get();
+        }
+
+        // Elite set keeps the best distinct orders, ties are broken by the iteration.
+        vector<const Solution*> feasibleSolutions;
+        for (auto &solution : solutions) {
+            if (solution.mIsFeasible) {
+                feasibleSolutions.push_back(&solution);
+            }
+        }
+        sort(feasibleSolutions.begin(), feasibleSolutions.end(), [&](const Solution *lhs, const Solution *rhs) {
+            if (obj.isBetter(lhs->mObjectiveValue, rhs->mObjectiveValue)) {
+                return true;
+            }
+            if (obj.isBetter(rhs->mObjectiveValue, lhs->mObjectiveValue)) {
+                return false;
+            }
+            return lhs->mIteration < rhs->mIteration;
+        });
+
+        mEliteSet.clear();
+        set<vector<const Operation*>> eliteOrders;
+        for (const Solution *pSolution : feasibleSolutions) {
+            if ((int)mEliteSet.size() >= scfg.mEliteSize) {
+                break;
+            }
+            if (eliteOrders.insert(pSolution->mOrdered).second) {
+                mEliteSet.push_back(*pSolution);
+            }
+        }
+
+        Solver::Result result(mIns.getNumOperations(), obj.worstValue());
+        if (!feasibleSolutions.empty()) {
+            const Solution &bestSolution = *feasibleSolutions.front();
+            result.setSolution(Solver::Result::Status::FEASIBLE, bestSolution.mStartTimes, bestSolution.mObjectiveValue);
+            cfg.publishIncumbent(bestSolution.mStartTimes, bestSolution.mObjectiveValue);
+        }
+
+        string eliteObjectiveValues;
+        for (auto &solution : mEliteSet) {
+            eliteObjectiveValues += (eliteObjectiveValues.empty() ? "" : ",") + to_string(solution.mObjectiveValue);
+        }
+        result.setOptional("eliteObjectiveValues", eliteObjectiveValues);
+        result.setOptional("numFeasibleConstructions", to_string(feasibleSolutions.size()));
+
+        stopwatch.stop();
+        result.setSolverRuntime(stopwatch.duration());
+        return result;
+    }
+
+    template <typename Alg>
+    Grasp::Solution Grasp::construct(const Solver::Config &cfg, const Grasp::Config &scfg, const int iteration) {
+        static const vector<string> rules = {GreedyHeuristics::Config::RULE_TARDINESS,
+                                             GreedyHeuristics::Config::RULE_DUE_DATES,
+                                             GreedyHeuristics::Config::RULE_RELEASE_TIMES,
+                                             GreedyHeuristics::Config::RULE_PROCESSING_TIMES,
+                                             GreedyHeuristics::Config::RULE_POWER_CONSUMPTIONS};
+        const string &rule = rules[iteration % rules.size()];
+        const bool isTardinessRule = rule == GreedyHeuristics::Config::RULE_TARDINESS;
+        // The first iteration of every rule is greedy, so that the result is never worse than the rules alone.
+        const double alpha = iteration < (int)rules.size() ? 0.0 : scfg.mAlpha;
+
+        seed_seq seedSequence = {scfg.mSeed, iteration};
+        mt19937 randomEngine(seedSequence);
+
+        set<int> remainingOperationIndices;
+        for (auto pOperation : mIns.getOperations()) {
+            remainingOperationIndices.insert(pOperation->getIndex());
+        }
+
+        Solution solution;
+        solution.mIteration = iteration;
+        solution.mOrdered.resize(mIns.getNumOperations(), nullptr);
+        Alg alg(mIns);
+        GreedyHeuristics::TardinessLookAhead lookAhead(mIns);
+
+        for (int forPosition = 0; forPosition < mIns.getNumOperations(); forPosition++) {
+            // Scores of the candidates (the lower the better), completion times break the ties of the greedy choice.
+            vector<tuple<double, int, int>> candidates;
+            for (int operationIndex : remainingOperationIndices) {
+                const Operation &operation = *mIns.getOperation(operationIndex);
+                if (!isTardinessRule) {
+                    candidates.emplace_back(computeStaticScore(rule, operation), 0, operationIndex);
+                    continue;
+                }
+
+                solution.mOrdered[forPosition] = &operation;
+                if (alg.appendPosition(solution.mOrdered, forPosition) == FeasibilityResult::INFEASIBLE) {
+                    continue;
+                }
+
+                int completionTime = alg.getStartTimes()[operation] + operation.getProcessingTime();
+                candidates.emplace_back((double)(max(0, completionTime - operation.getDueDate())
+                                                 + lookAhead.compute(completionTime)
+                                                 - GreedyHeuristics::TardinessLookAhead::computeTardiness(operation, completionTime)),
+                                        completionTime,
+                                        operationIndex);
+            }
+
+            // Candidates infeasible at this position are dropped and another one is drawn.
+            bool appended = false;
+            while (!appended && !candidates.empty()) {
+                int candidate = 0;
+                if (alpha == 0.0) {
+                    for (int other = 1; other < (int)candidates.size(); other++) {
+                        double score = get<0>(candidates[other]);
+                        double bestScore = get<0>(candidates[candidate]);
+                        if (score < bestScore || (GeneralUtils::areClose(score, bestScore) && get<1>(candidates[other]) < get<1>(candidates[candidate]))) {
+                            candidate = other;
+                        }
+                    }
+                }
+                else {
+                    auto minMax = minmax_element(candidates.begin(), candidates.end());
+                    double threshold = get<0>(*minMax.first) + alpha * (get<0>(*minMax.second) - get<0>(*minMax.first));
+
+                    vector<int> restrictedCandidates;
+                    for (int other = 0; other < (int)candidates.size(); other++) {
+                        if (get<0>(candidates[other]) <= threshold + 1e-9) {
+                            restrictedCandidates.push_back(other);
+                        }
+                    }
+                    candidate = restrictedCandidates[uniform_int_distribution<int>(0, (int)restrictedCandidates.size() - 1)(randomEngine)];
+                }
+
+                const Operation *pOperation = mIns.getOperation(get<2>(candidates[candidate]));
+                solution.mOrdered[forPosition] = pOperation;
+                if (alg.appendPosition(solution.mOrdered, forPosition) == FeasibilityResult::FEASIBLE) {
+                    remainingOperationIndices.erase(pOperation->getIndex());
+                    lookAhead.remove(*pOperation);
+                    appended = true;
+                }
+                else {
+                    candidates.erase(candidates.begin() + candidate);
+                }
+            }
+
+            if (!appended) {
+                return solution;
+            }
+        }
+
+        solution.mStartTimes = alg.getStartTimes();
+        solution.mObjectiveValue = cfg.getObjective()->compute(mIns, solution.mStartTimes);
+        solution.mIsFeasible = true;
+        return solution;
+    }
+
+    double Grasp::computeStaticScore(const string &rule, const Operation &operation) const {
+        if (rule == GreedyHeuristics::Config::RULE_DUE_DATES) {
+            return operation.getDueDate();
+        }
+        else if (rule == GreedyHeuristics::Config::RULE_RELEASE_TIMES) {
+            return operation.getReleaseTime();
+        }
+        else if (rule == GreedyHeuristics::Config::RULE_PROCESSING_TIMES) {
+            return operation.getProcessingTime();
+        }
+        else {
+            return operation.getPowerConsumption();
+        }
+    }
+}
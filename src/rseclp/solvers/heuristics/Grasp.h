@@ -0,0 +1,97 @@
+/*
+    
+    Copyright (C) 2017 Czech Technical University in Prague
+    The MIT License (MIT)
+    
+    Permission is hereby granted, free of charge, to any person obtaining
+    a copy of this software and associated documentation files
+    (the "Software"), to deal in the Software without restriction,
+    including without limitation the rights to use, copy, modify, merge,
+    publish, distribute, sublicense, and/or sell copies of the Software,
+    and to permit persons to whom the Software is furnished to do so,
+    subject to the following conditions:
+    
+    The above copyright notice and this permission notice shall be
+    included in all copies or substantial portions of the Software.
+    
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+    EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+    MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+    IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+    CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+    TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+    SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+#ifndef ROBUSTENERGYAWARESCHEDULING_GRASP_H
+#define ROBUSTENERGYAWARESCHEDULING_GRASP_H
+
+#include <random>
+#include "../../instance/Instance.h"
+#include "../Solver.h"
+#include "../../utils/Deadline.h"
+
+namespace rseclp {
+    using namespace std;
+
+    // Greedy randomised adaptive search: every iteration builds an order by one of the rules of GreedyHeuristics,
+    // choosing each position uniformly from the restricted candidate list (scores within alpha of the best ones).
+    class Grasp : public Solver {
+    public:
+        static const string KEY_SOLVER;
+
+        class Config {
+        public:
+            static const string KEY_ALPHA;
+            static const string KEY_NUM_ITERATIONS;
+            static const string KEY_NUM_THREADS;
+            static const string KEY_SEED;
+            static const string KEY_ELITE_SIZE;
+
+            // 0 is the pure greedy, 1 is uniformly random.
+            const double mAlpha;
+            const int mNumIterations;
+            const int mNumThreads;
+            // Iteration i uses the random engine seeded by (seed, i), so the result does not depend on the threads.
+            const int mSeed;
+            const int mEliteSize;
+
+            Config(const double alpha, const int numIterations, const int numThreads, const int seed, const int eliteSize);
+
+            static Config createFrom(const Solver::Config &cfg);
+        };
+
+        class Solution {
+        public:
+            vector<const Operation*> mOrdered;
+            StartTimes mStartTimes;
+            bool mIsFeasible;
+            double mObjectiveValue;
+            int mIteration;
+
+            Solution();
+        };
+
+        Grasp(const Instance &ins);
+
+        virtual Solver::Result solve(const Solver::Config &cfg);
+
+        // Best distinct solutions of the last solve, the best first.
+        const vector<Solution> &getEliteSet() const;
+
+    private:
+        const Instance &mIns;
+        vector<Solution> mEliteSet;
+
+        template <typename Alg>
+        Solver::Result solveWith(const Solver::Config &cfg);
+
+        template <typename Alg>
+        Solution construct(const Solver::Config &cfg, const Config &scfg, const int iteration);
+
+        double computeStaticScore(const string &rule, const Operation &operation) const;
+    };
+}
+
+
+#endif //ROBUSTENERGYAWARESCHEDULING_GRASP_H
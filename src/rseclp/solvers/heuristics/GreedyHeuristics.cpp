@@ -29,7 +29,8 @@
 #include "GreedyHeuristics.h"
 #include "../../utils/Stopwatch.h"
 #include "../../utils/GeneralUtils.h"
-#include "../fixed-order/RobustScheduleFixedOrderDefault.h"
+#include "../fixed-order/RobustScheduleFixedOrder2016B.h"
+#include "../fixed-order/RobustScheduleFixedOrderOptimised.h"
 #include "../../objectives/TotalTardiness.h"
 
 namespace rseclp {
@@ -105,6 +106,7 @@ namespace rseclp {
         return ordered;
     }
 
+    template <typename Alg>
     vector<const Operation*> GreedyHeuristics::ruleTardiness() {
         set<int> remainingOperationIndices;
         for (auto pOperation : mIns.getOperations()) {
@@ -112,8 +114,9 @@ namespace rseclp {
         }
 
         vector<const Operation*> ordered(mIns.getNumOperations(), nullptr);
-        RobustScheduleFixedOrderDefault alg(mIns);
+        Alg alg(mIns);
         TotalTardiness obj;
+        TardinessLookAhead lookAhead(mIns);
 
         for (int forPosition = 0; forPosition < mIns.getNumOperations(); forPosition++) {
             double bestObjVal = obj.worstValue();
@@ -130,15 +133,9 @@ namespace rseclp {
                 }
 
                 int completionTime = alg.getStartTimes()[operation] + operation.getProcessingTime();
-                double objVal = max(0, completionTime - operation.getDueDate());
-                for (int operationIndexPrime : remainingOperationIndices) {
-                    if (operationIndex != operationIndexPrime) {
-                        const Operation &operationPrime = *mIns.getOperation(operationIndexPrime);
-
-                        objVal += max(0,
-                                      max(completionTime, operationPrime.getReleaseTime()) + operationPrime.getProcessingTime() - operationPrime.getDueDate());
-                    }
-                }
+                double objVal = (double)(max(0, completionTime - operation.getDueDate())
+                                         + lookAhead.compute(completionTime)
+                                         - TardinessLookAhead::computeTardiness(operation, completionTime));
 
                 if (objVal < bestObjVal || (GeneralUtils::areClose(objVal, bestObjVal) && completionTime < bestCompletionTime)) {
                     bestObjVal = objVal;
@@ -152,6 +149,7 @@ namespace rseclp {
             }
 
             remainingOperationIndices.erase(bestOperationIndex);
+            lookAhead.remove(*mIns.getOperation(bestOperationIndex));
             ordered[forPosition] = mIns.getOperation(bestOperationIndex);
             alg.appendPosition(ordered, forPosition);
         }
@@ -159,6 +157,67 @@ namespace rseclp {
         return ordered;
     }
 
+    template vector<const Operation*> GreedyHeuristics::ruleTardiness<RobustScheduleFixedOrder2016B>();
+    template vector<const Operation*> GreedyHeuristics::ruleTardiness<RobustScheduleFixedOrderOptimised>();
+
+    GreedyHeuristics::TardinessLookAhead::TardinessLookAhead(const Instance &ins)
+            : mKeyRanks(ins.getNumOperations()),
+              mReleaseTimeRanks(ins.getNumOperations()),
+              mNumOperations(ins.getNumOperations()),
+              mSlackTimes(ins.getNumOperations()),
+              mReleaseTardiness(ins.getNumOperations()) {
+        vector<int> byKey(ins.getNumOperations());
+        iota(byKey.begin(), byKey.end(), 0);
+        auto byReleaseTime = byKey;
+
+        auto key = [&](int operationIndex) {
+            const Operation &operation = *ins.getOperation(operationIndex);
+            return max(operation.getReleaseTime(), operation.getDueDate() - operation.getProcessingTime() + 1);
+        };
+        sort(byKey.begin(), byKey.end(), [&](int lhs, int rhs) { return key(lhs) < key(rhs); });
+        sort(byReleaseTime.begin(), byReleaseTime.end(), [&](int lhs, int rhs) {
+            return ins.getOperation(lhs)->getReleaseTime() < ins.getOperation(rhs)->getReleaseTime();
+        });
+
+        for (int rank = 0; rank < ins.getNumOperations(); rank++) {
+            mKeyRanks[byKey[rank]] = rank;
+            mSortedKeys.push_back(key(byKey[rank]));
+            mReleaseTimeRanks[byReleaseTime[rank]] = rank;
+            mSortedReleaseTimes.push_back(ins.getOperation(byReleaseTime[rank])->getReleaseTime());
+        }
+
+        for (auto *pOperation : ins.getOperations()) {
+            update(*pOperation, 1);
+        }
+    }
+
+    void GreedyHeuristics::TardinessLookAhead::update(const Operation &operation, const int sign) {
+        mNumOperations.add(mKeyRanks[operation.getIndex()], sign);
+        mSlackTimes.add(mKeyRanks[operation.getIndex()], sign * (long long)(operation.getDueDate() - operation.getProcessingTime()));
+        mReleaseTardiness.add(mReleaseTimeRanks[operation.getIndex()],
+                              sign * (long long)computeTardiness(operation, operation.getReleaseTime()));
+    }
+
+    void GreedyHeuristics::TardinessLookAhead::remove(const Operation &operation) {
+        update(operation, -1);
+    }
+
+    long long GreedyHeuristics::TardinessLookAhead::compute(const int completionTime) const {
+        // Operations released until completionTime are tardy by completionTime - (d - p) if positive, i.e. if their
+        // key max(r, d - p + 1) is at most completionTime, the later released ones by max(0, r + p - d).
+        int numKeys = (int)distance(mSortedKeys.begin(), upper_bound(mSortedKeys.begin(), mSortedKeys.end(), completionTime));
+        int numReleased = (int)distance(mSortedReleaseTimes.begin(),
+                                        upper_bound(mSortedReleaseTimes.begin(), mSortedReleaseTimes.end(), completionTime));
+
+        return mNumOperations.prefixSum(numKeys) * completionTime
+               - mSlackTimes.prefixSum(numKeys)
+               + mReleaseTardiness.total() - mReleaseTardiness.prefixSum(numReleased);
+    }
+
+    long long GreedyHeuristics::TardinessLookAhead::computeTardiness(const Operation &operation, const int machineFreeTime) {
+        return max(0, max(machineFreeTime, operation.getReleaseTime()) + operation.getProcessingTime() - operation.getDueDate());
+    }
+
     vector<const Operation*> GreedyHeuristics::ruleRandom() {
         vector<const Operation*> ordered(mIns.getOperations());
         random_shuffle(ordered.begin(), ordered.end());
@@ -166,6 +225,15 @@ namespace rseclp {
     }
 
     Solver::Result GreedyHeuristics::solve(const Solver::Config &cfg) {
+        if (cfg.getFixedOrderEngine() == FixedOrderEngine::FIXED_ORDER_OPTIMISED) {
+            return solveWith<RobustScheduleFixedOrderOptimised>(cfg);
+        }
+
+        return solveWith<RobustScheduleFixedOrder2016B>(cfg);
+    }
+
+    template <typename Alg>
+    Solver::Result GreedyHeuristics::solveWith(const Solver::Config &cfg) {
         Stopwatch stopwatch;
         stopwatch.start();
 
@@ -191,7 +259,7 @@ namespace rseclp {
         }
         else if (scfg.mRule == Config::RULE_TARDINESS) {
             assert(cfg.getObjective()->getType() == Objective::Type::TOTAL_TARDINESS);
-            ordered = ruleTardiness();
+            ordered = ruleTardiness<Alg>();
         }
         else {
             cout << "Invalid rule " << scfg.mRule << endl;
@@ -199,11 +267,12 @@ namespace rseclp {
         }
 
         if (ordered.size() != 0) {
-            RobustScheduleFixedOrderDefault alg(mIns);
+            Alg alg(mIns);
             if (alg.create(ordered) == FeasibilityResult::FEASIBLE) {
                 result.setSolution(Solver::Result::Status::FEASIBLE,
                                    alg.getStartTimes(),
                                    cfg.getObjective()->compute(mIns, alg.getStartTimes()));
+                cfg.publishIncumbent(result.getStartTimes(), result.getObjectiveValue());
             }
         }
 
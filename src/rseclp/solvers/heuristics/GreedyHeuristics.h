@@ -30,6 +30,7 @@
 #include <numeric>
 #include "../../instance/Instance.h"
 #include "../Solver.h"
+#include "../../utils/FenwickTree.h"
 
 namespace rseclp {
     using namespace std;
@@ -62,6 +63,32 @@ namespace rseclp {
             static Config createFrom(const Solver::Config &cfg);
         };
 
+        // Total tardiness of the remaining operations, each scheduled alone right after the given completion time.
+        class TardinessLookAhead {
+        private:
+            // Ranks and sorted values of key max(r, d - p + 1) and of release times r of all the operations.
+            vector<int> mKeyRanks;
+            vector<int> mSortedKeys;
+            vector<int> mReleaseTimeRanks;
+            vector<int> mSortedReleaseTimes;
+
+            // Remaining operations indexed by the rank of the key and the release time.
+            FenwickTree<long long> mNumOperations;
+            FenwickTree<long long> mSlackTimes;
+            FenwickTree<long long> mReleaseTardiness;
+
+            void update(const Operation &operation, const int sign);
+
+        public:
+            TardinessLookAhead(const Instance &ins);
+
+            void remove(const Operation &operation);
+
+            long long compute(const int completionTime) const;
+
+            static long long computeTardiness(const Operation &operation, const int machineFreeTime);
+        };
+
         GreedyHeuristics(const Instance &ins);
 
         vector<const Operation*> ruleDueDates(bool ascending);
@@ -72,11 +99,16 @@ namespace rseclp {
 
         vector<const Operation*> rulePowerConsumptions(bool ascending);
 
+        template <typename Alg>
         vector<const Operation*> ruleTardiness();
 
         vector<const Operation*> ruleRandom();
 
         virtual Solver::Result solve(const Solver::Config &cfg);
+
+    private:
+        template <typename Alg>
+        Solver::Result solveWith(const Solver::Config &cfg);
     };
 }
 
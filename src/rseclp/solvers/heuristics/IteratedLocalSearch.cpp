@@ -0,0 +1,307 @@
+/*
+    
+    Copyright (C) 2017 Czech Technical University in Prague
+    The MIT License (MIT)
+    
+    Permission is hereby granted, free of charge, to any person obtaining
+    a copy of this software and associated documentation files
+    (the "Software"), to deal in the Software without restriction,
+    including without limitation the rights to use, copy, modify, merge,
+    publish, distribute, sublicense, and/or sell copies of the Software,
+    and to permit persons to whom the Software is furnished to do so,
+    subject to the following conditions:
+    
+    The above copyright notice and this permission notice shall be
+    included in all copies or substantial portions of the Software.
+    
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+    EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+    MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+    IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+    CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+    TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+    SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+#include <algorithm>
+#include <cmath>
+#include "IteratedLocalSearch.h"
+#include "GreedyHeuristics.h"
+#include "../../utils/Stopwatch.h"
+#include "../../utils/GeneralUtils.h"
+#include "../../feasibility-checkers/FeasibilityChecker.h"
+#include "../fixed-order/RobustScheduleFixedOrder2016B.h"
+#include "../fixed-order/RobustScheduleFixedOrderOptimised.h"
+
+namespace rseclp {
+    const string IteratedLocalSearch::KEY_SOLVER = "IteratedLocalSearch";
+
+    const string IteratedLocalSearch::Config::KEY_NUM_ITERATIONS = "numIterations";
+    const string IteratedLocalSearch::Config::KEY_PERTURBATION_STRENGTH = "perturbationStrength";
+    const string IteratedLocalSearch::Config::KEY_MAX_BLOCK_LENGTH = "maxBlockLength";
+    const string IteratedLocalSearch::Config::KEY_ACCEPTANCE_TOLERANCE = "acceptanceTolerance";
+    const string IteratedLocalSearch::Config::KEY_SEED = "seed";
+
+    const int IteratedLocalSearch::MOVE_BATCH_SIZE = 64;
+
+    IteratedLocalSearch::Config::Config(const int numIterations,
+                                        const int perturbationStrength,
+                                        const int maxBlockLength,
+                                        const double acceptanceTolerance,
+                                        const int seed)
+            : mNumIterations(numIterations),
+              mPerturbationStrength(perturbationStrength),
+              mMaxBlockLength(maxBlockLength),
+              mAcceptanceTolerance(acceptanceTolerance),
+              mSeed(seed) {}
+
+    IteratedLocalSearch::Config IteratedLocalSearch::Config::createFrom(const Solver::Config &cfg) {
+        auto &scfg = cfg.getSpecialisedConfig();
+
+        return IteratedLocalSearch::Config(scfg.getValue<int>(KEY_SOLVER, KEY_NUM_ITERATIONS, 100),
+                                           scfg.getValue<int>(KEY_SOLVER, KEY_PERTURBATION_STRENGTH, 3),
+                                           scfg.getValue<int>(KEY_SOLVER, KEY_MAX_BLOCK_LENGTH, 3),
+                                           scfg.getValue<double>(KEY_SOLVER, KEY_ACCEPTANCE_TOLERANCE, 0.0),
+                                           scfg.getValue<int>(KEY_SOLVER, KEY_SEED, 42));
+    }
+
+    IteratedLocalSearch::Solution::Solution() : mIsFeasible(false), mObjectiveValue(numeric_limits<double>::max()) {}
+
+    IteratedLocalSearch::Move::Move(int from, int length, int to) : mFrom(from), mLength(length), mTo(to) {}
+
+    void IteratedLocalSearch::Move::apply(vector<const Operation*> &ordered) const {
+        if (mTo > mFrom) {
+            rotate(ordered.begin() + mFrom, ordered.begin() + mFrom + mLength, ordered.begin() + mTo + mLength);
+        }
+        else {
+            rotate(ordered.begin() + mTo, ordered.begin() + mFrom, ordered.begin() + mFrom + mLength);
+        }
+    }
+
+    IteratedLocalSearch::IteratedLocalSearch(const Instance &ins)
+            : mIns(ins), mNumEvaluatedMoves(0), mNumLocalOptima(0) {}
+
+    Solver::Result IteratedLocalSearch::solve(const Solver::Config &cfg) {
+        if (cfg.getFixedOrderEngine() == FixedOrderEngine::FIXED_ORDER_OPTIMISED) {
+            return solveWith<RobustScheduleFixedOrderOptimised>(cfg);
+        }
+
+        return solveWith<RobustScheduleFixedOrder2016B>(cfg);
+    }
+
+    template <typename Alg>
+    Solver::Result IteratedLocalSearch::solveWith(const Solver::Config &cfg) {
+        Stopwatch stopwatch;
+        stopwatch.start();
+        Deadline deadline(cfg.getTimeLimit(), cfg.getCancellationFlag());
+
+        auto scfg = IteratedLocalSearch::Config::createFrom(cfg);
+        const Objective &obj = *cfg.getObjective();
+        mNumEvaluatedMoves = 0;
+        mNumLocalOptima = 0;
+
+        // The search starts from the incumbent, the initial solution or the greedy tardiness rule, whichever is known.
+        Solution current;
+        Solver::Result result(mIns.getNumOperations(), obj.worstValue());
+        if (cfg.getUseInitStartTimes() && FeasibilityChecker(mIns).areFeasible(cfg.getInitStartTimes())) {
+            result.setSolution(Solver::Result::Status::FEASIBLE,
+                               cfg.getInitStartTimes(),
+                               obj.compute(mIns, cfg.getInitStartTimes()));
+        }
+
+        StartTimes incumbentStartTimes;
+        double incumbentObjVal;
+        if (cfg.testAndGetBetterIncumbent(result.getObjectiveValue(), incumbentStartTimes, incumbentObjVal)) {
+            result.setSolution(Solver::Result::Status::FEASIBLE, incumbentStartTimes, incumbentObjVal);
+        }
+
+        if (result.getStatus() == Solver::Result::Status::FEASIBLE) {
+            current.mStartTimes = result.getStartTimes();
+            current.mOrdered = current.mStartTimes.getOperationsOrdered(mIns);
+            current.mIsFeasible = true;
+            current.mObjectiveValue = result.getObjectiveValue();
+        }
+        else {
+            Alg alg(mIns);
+            current.mOrdered = GreedyHeuristics(mIns).ruleTardiness<Alg>();
+            if (current.mOrdered.empty()) {
+                // The greedy rule got stuck, the descent starts from the infeasible EDD order instead.
+                current.mOrdered = GreedyHeuristics(mIns).ruleDueDates(true);
+            }
+
+            current.mIsFeasible = alg.create(current.mOrdered) == FeasibilityResult::FEASIBLE;
+            current.mStartTimes = alg.getStartTimes();
+            current.mObjectiveValue = current.mIsFeasible ? obj.compute(mIns, current.mStartTimes) : obj.worstValue();
+        }
+
+        vector<vector<Move>> neighbourhoods = {createMoves(Neighbourhood::ADJACENT_SWAP, scfg),
+                                               createMoves(Neighbourhood::INSERT, scfg),
+                                               createMoves(Neighbourhood::BLOCK, scfg)};
+
+        BatchFixedOrderEvaluator<Alg> evaluator(mIns, obj);
+        descend<Alg>(cfg, neighbourhoods, current, evaluator, deadline);
+        Solution best = current;
+        if (best.mIsFeasible) {
+            cfg.publishIncumbent(best.mStartTimes, best.mObjectiveValue);
+        }
+
+        mt19937 randomEngine((unsigned int)scfg.mSeed);
+        for (int iteration = 0; iteration < scfg.mNumIterations && mIns.getNumOperations() > 1; iteration++) {
+            if (deadline.reached()) {
+                break;
+            }
+
+            Solution candidate;
+            candidate.mOrdered = current.mOrdered;
+            perturb(scfg, candidate.mOrdered, randomEngine);
+
+            evaluator.clear();
+            evaluator.addOrder(candidate.mOrdered);
+            evaluator.evaluate();
+            mNumEvaluatedMoves++;
+            if (evaluator.isFeasible(0)) {
+                candidate.mStartTimes = evaluator.getStartTimes(0);
+                candidate.mIsFeasible = true;
+                candidate.mObjectiveValue = evaluator.getObjectiveValue(0);
+            }
+
+            descend<Alg>(cfg, neighbourhoods, candidate, evaluator, deadline);
+            if (!candidate.mIsFeasible) {
+                continue;
+            }
+
+            if (obj.isBetter(candidate.mObjectiveValue, best.mObjectiveValue)) {
+                best = candidate;
+                cfg.publishIncumbent(best.mStartTimes, best.mObjectiveValue);
+            }
+
+            double acceptedObjVal = current.mObjectiveValue + scfg.mAcceptanceTolerance * fabs(current.mObjectiveValue);
+            if (!current.mIsFeasible || !obj.isBetter(acceptedObjVal, candidate.mObjectiveValue)) {
+                current = move(candidate);
+            }
+        }
+
+        if (best.mIsFeasible
+            && (result.getStatus() == Solver::Result::Status::NO_SOLUTION
+                || obj.isBetter(best.mObjectiveValue, result.getObjectiveValue()))) {
+            result.setSolution(Solver::Result::Status::FEASIBLE, best.mStartTimes, best.mObjectiveValue);
+        }
+
+        result.setOptional("numEvaluatedMoves", to_string(mNumEvaluatedMoves));
+        result.setOptional("numLocalOptima", to_string(mNumLocalOptima));
+
+        stopwatch.stop();
+        result.setSolverRuntime(stopwatch.duration());
+        return result;
+    }
+
+    template <typename Alg>
+    void IteratedLocalSearch::descend(const Solver::Config &cfg,
+                                      const vector<vector<Move>> &neighbourhoods,
+                                      IteratedLocalSearch::Solution &solution,
+                                      BatchFixedOrderEvaluator<Alg> &evaluator,
+                                      Deadline &deadline) {
+        int neighbourhood = 0;
+        while (neighbourhood < (int)neighbourhoods.size()) {
+            if (deadline.reached()) {
+                return;
+            }
+
+            if (improve<Alg>(cfg, neighbourhoods[neighbourhood], solution, evaluator, deadline)) {
+                neighbourhood = 0;
+            }
+            else {
+                neighbourhood++;
+            }
+        }
+
+        mNumLocalOptima++;
+    }
+
+    template <typename Alg>
+    bool IteratedLocalSearch::improve(const Solver::Config &cfg,
+                                      const vector<Move> &moves,
+                                      IteratedLocalSearch::Solution &solution,
+                                      BatchFixedOrderEvaluator<Alg> &evaluator,
+                                      Deadline &deadline) {
+        const Objective &obj = *cfg.getObjective();
+
+        int nextMove = 0;
+        while (nextMove < (int)moves.size() && !deadline.reached()) {
+            evaluator.clear();
+            for (; nextMove < (int)moves.size() && evaluator.getNumOrders() < MOVE_BATCH_SIZE; nextMove++) {
+                vector<const Operation*> ordered(solution.mOrdered);
+                moves[nextMove].apply(ordered);
+                evaluator.addOrder(ordered);
+            }
+            evaluator.evaluate();
+            mNumEvaluatedMoves += evaluator.getNumOrders();
+
+            int bestCandidate = -1;
+            double bestObjVal = solution.mObjectiveValue;
+            for (int candidate = 0; candidate < evaluator.getNumOrders(); candidate++) {
+                if (evaluator.isFeasible(candidate) && obj.isBetter(evaluator.getObjectiveValue(candidate), bestObjVal)) {
+                    bestCandidate = candidate;
+                    bestObjVal = evaluator.getObjectiveValue(candidate);
+                }
+            }
+
+            if (bestCandidate != -1) {
+                solution.mOrdered = evaluator.getOrdered(bestCandidate);
+                solution.mStartTimes = evaluator.getStartTimes(bestCandidate);
+                solution.mIsFeasible = true;
+                solution.mObjectiveValue = bestObjVal;
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    vector<IteratedLocalSearch::Move> IteratedLocalSearch::createMoves(Neighbourhood neighbourhood,
+                                                                       const IteratedLocalSearch::Config &scfg) const {
+        const int numOperations = mIns.getNumOperations();
+        vector<Move> moves;
+        switch (neighbourhood) {
+            case Neighbourhood::ADJACENT_SWAP:
+                for (int from = 0; from + 1 < numOperations; from++) {
+                    moves.emplace_back(from, 1, from + 1);
+                }
+                break;
+
+            case Neighbourhood::INSERT:
+                // Inserts to the neighbouring positions are the adjacent swaps.
+                for (int from = 0; from < numOperations; from++) {
+                    for (int to = 0; to < numOperations; to++) {
+                        if (abs(to - from) > 1) {
+                            moves.emplace_back(from, 1, to);
+                        }
+                    }
+                }
+                break;
+
+            case Neighbourhood::BLOCK:
+                for (int length = 2; length <= min(scfg.mMaxBlockLength, numOperations - 1); length++) {
+                    for (int from = 0; from + length <= numOperations; from++) {
+                        for (int to = 0; to + length <= numOperations; to++) {
+                            if (to != from) {
+                                moves.emplace_back(from, length, to);
+                            }
+                        }
+                    }
+                }
+                break;
+        }
+
+        return moves;
+    }
+
+    void IteratedLocalSearch::perturb(const IteratedLocalSearch::Config &scfg,
+                                      vector<const Operation*> &ordered,
+                                      mt19937 &randomEngine) const {
+        for (int swap = 0; swap < scfg.mPerturbationStrength; swap++) {
+            auto positions = GeneralUtils::twoDifferentRandomIntegers(0, (int)ordered.size() - 1, randomEngine);
+            iter_swap(ordered.begin() + positions.first, ordered.begin() + positions.second);
+        }
+    }
+}
@@ -0,0 +1,137 @@
+/*
+    
+    Copyright (C) 2017 Czech Technical University in Prague
+    The MIT License (MIT)
+    
+    Permission is hereby granted, free of charge, to any person obtaining
+    a copy of this software and associated documentation files
+    (the "Software"), to deal in the Software without restriction,
+    including without limitation the rights to use, copy, modify, merge,
+    publish, distribute, sublicense, and/or sell copies of the Software,
+    and to permit persons to whom the Software is furnished to do so,
+    subject to the following conditions:
+    
+    The above copyright notice and this permission notice shall be
+    included in all copies or substantial portions of the Software.
+    
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+    EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+    MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+    IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+    CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+    TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+    SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+#ifndef ROBUSTENERGYAWARESCHEDULING_ITERATEDLOCALSEARCH_H
+#define ROBUSTENERGYAWARESCHEDULING_ITERATEDLOCALSEARCH_H
+
+#include <random>
+#include "../../instance/Instance.h"
+#include "../Solver.h"
+#include "../../utils/Deadline.h"
+#include "../fixed-order/BatchFixedOrderEvaluator.h"
+
+namespace rseclp {
+    using namespace std;
+
+    // Iterated local search: every local optimum is found by variable neighbourhood descent over adjacent swaps,
+    // inserts and block moves, then it is perturbed by random swaps and the descent is repeated.
+    class IteratedLocalSearch : public Solver {
+    public:
+        static const string KEY_SOLVER;
+
+        class Config {
+        public:
+            static const string KEY_NUM_ITERATIONS;
+            static const string KEY_PERTURBATION_STRENGTH;
+            static const string KEY_MAX_BLOCK_LENGTH;
+            static const string KEY_ACCEPTANCE_TOLERANCE;
+            static const string KEY_SEED;
+
+            // Number of perturbations, 0 stops at the first local optimum.
+            const int mNumIterations;
+            // Number of random swaps of one perturbation.
+            const int mPerturbationStrength;
+            const int mMaxBlockLength;
+            // Local optimum is accepted if it is worse than the current one by at most this fraction of its value.
+            const double mAcceptanceTolerance;
+            const int mSeed;
+
+            Config(const int numIterations,
+                   const int perturbationStrength,
+                   const int maxBlockLength,
+                   const double acceptanceTolerance,
+                   const int seed);
+
+            static Config createFrom(const Solver::Config &cfg);
+        };
+
+        IteratedLocalSearch(const Instance &ins);
+
+        virtual Solver::Result solve(const Solver::Config &cfg);
+
+    private:
+        class Solution {
+        public:
+            vector<const Operation*> mOrdered;
+            StartTimes mStartTimes;
+            bool mIsFeasible;
+            double mObjectiveValue;
+
+            Solution();
+        };
+
+        // Block of operations starting at mFrom moved so that it starts at mTo, adjacent swap and insert are blocks of
+        // length one.
+        class Move {
+        public:
+            int mFrom;
+            int mLength;
+            int mTo;
+
+            Move(int from, int length, int to);
+
+            void apply(vector<const Operation*> &ordered) const;
+        };
+
+        enum class Neighbourhood {
+            ADJACENT_SWAP,
+            INSERT,
+            BLOCK
+        };
+
+        // Moves are evaluated in batches of this size, the deadline is checked between them.
+        static const int MOVE_BATCH_SIZE;
+
+        const Instance &mIns;
+        long mNumEvaluatedMoves;
+        int mNumLocalOptima;
+
+        template <typename Alg>
+        Solver::Result solveWith(const Solver::Config &cfg);
+
+        // Neighbourhoods are searched in the given order, the search returns to the first one after every improvement.
+        template <typename Alg>
+        void descend(const Solver::Config &cfg,
+                     const vector<vector<Move>> &neighbourhoods,
+                     Solution &solution,
+                     BatchFixedOrderEvaluator<Alg> &evaluator,
+                     Deadline &deadline);
+
+        // Applies the best improving move of the first batch containing one.
+        template <typename Alg>
+        bool improve(const Solver::Config &cfg,
+                     const vector<Move> &moves,
+                     Solution &solution,
+                     BatchFixedOrderEvaluator<Alg> &evaluator,
+                     Deadline &deadline);
+
+        vector<Move> createMoves(Neighbourhood neighbourhood, const Config &scfg) const;
+
+        void perturb(const Config &scfg, vector<const Operation*> &ordered, mt19937 &randomEngine) const;
+    };
+}
+
+
+#endif //ROBUSTENERGYAWARESCHEDULING_ITERATEDLOCALSEARCH_H
@@ -0,0 +1,218 @@
+/*
+    
+    Copyright (C) 2017 Czech Technical University in Prague
+    The MIT License (MIT)
+    
+    Permission is hereby granted, free of charge, to any person obtaining
+    a copy of this software and associated documentation files
+    (the "Software"), to deal in the Software without restriction,
+    including without limitation the rights to use, copy, modify, merge,
+    publish, distribute, sublicense, and/or sell copies of the Software,
+    and to permit persons to whom the Software is furnished to do so,
+    subject to the following conditions:
+    
+    The above copyright notice and this permission notice shall be
+    included in all copies or substantial portions of the Software.
+    
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+    EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+    MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+    IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+    CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+    TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+    SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+#include <algorithm>
+#include "LargeNeighbourhoodSearch.h"
+#include "GreedyHeuristics.h"
+#include "../exact/BranchAndBoundOnOrder.h"
+#include "../../utils/Stopwatch.h"
+#include "../../utils/Deadline.h"
+#include "../../utils/EnergyProfile.h"
+#include "../../feasibility-checkers/FeasibilityChecker.h"
+#include "../fixed-order/RobustScheduleFixedOrder2016B.h"
+#include "../fixed-order/RobustScheduleFixedOrderOptimised.h"
+
+namespace rseclp {
+    const string LargeNeighbourhoodSearch::KEY_SOLVER = "LargeNeighbourhoodSearch";
+
+    const string LargeNeighbourhoodSearch::Config::KEY_WINDOW_SIZE = "windowSize";
+    const string LargeNeighbourhoodSearch::Config::KEY_WINDOW_TIME_LIMIT = "windowTimeLimit";
+    const string LargeNeighbourhoodSearch::Config::KEY_NUM_ITERATIONS = "numIterations";
+
+    LargeNeighbourhoodSearch::Config::Config(const int windowSize, const int windowTimeLimit, const int numIterations)
+            : mWindowSize(windowSize), mWindowTimeLimit(windowTimeLimit), mNumIterations(numIterations) {}
+
+    LargeNeighbourhoodSearch::Config LargeNeighbourhoodSearch::Config::createFrom(const Solver::Config &cfg) {
+        auto &scfg = cfg.getSpecialisedConfig();
+
+        return LargeNeighbourhoodSearch::Config(scfg.getValue<int>(KEY_SOLVER, KEY_WINDOW_SIZE, 8),
+                                                scfg.getValue<int>(KEY_SOLVER, KEY_WINDOW_TIME_LIMIT, 1000),
+                                                scfg.getValue<int>(KEY_SOLVER, KEY_NUM_ITERATIONS, -1));
+    }
+
+    LargeNeighbourhoodSearch::LargeNeighbourhoodSearch(const Instance &ins) : mIns(ins) {}
+
+    Solver::Result LargeNeighbourhoodSearch::solve(const Solver::Config &cfg) {
+        if (cfg.getFixedOrderEngine() == FixedOrderEngine::FIXED_ORDER_OPTIMISED) {
+            return solveWith<RobustScheduleFixedOrderOptimised>(cfg);
+        }
+
+        return solveWith<RobustScheduleFixedOrder2016B>(cfg);
+    }
+
+    template <typename Alg>
+    Solver::Result LargeNeighbourhoodSearch::solveWith(const Solver::Config &cfg) {
+        Stopwatch stopwatch;
+        stopwatch.start();
+        Deadline deadline(cfg.getTimeLimit(), cfg.getCancellationFlag());
+
+        auto scfg = LargeNeighbourhoodSearch::Config::createFrom(cfg);
+        const Objective &obj = *cfg.getObjective();
+        const int numOperations = mIns.getNumOperations();
+
+        Solver::Result result(numOperations, obj.worstValue());
+        if (cfg.getUseInitStartTimes() && FeasibilityChecker(mIns).areFeasible(cfg.getInitStartTimes())) {
+            result.setSolution(Solver::Result::Status::FEASIBLE,
+                               cfg.getInitStartTimes(),
+                               obj.compute(mIns, cfg.getInitStartTimes()));
+        }
+
+        StartTimes incumbentStartTimes;
+        double incumbentObjVal;
+        if (cfg.testAndGetBetterIncumbent(result.getObjectiveValue(), incumbentStartTimes, incumbentObjVal)) {
+            result.setSolution(Solver::Result::Status::FEASIBLE, incumbentStartTimes, incumbentObjVal);
+        }
+
+        // Without a known solution, the search starts from the greedy tardiness order.
+        vector<const Operation*> ordered;
+        StartTimes startTimes;
+        if (result.getStatus() == Solver::Result::Status::FEASIBLE) {
+            startTimes = result.getStartTimes();
+            ordered = startTimes.getOperationsOrdered(mIns);
+        }
+        else {
+            Alg alg(mIns);
+            ordered = GreedyHeuristics(mIns).ruleTardiness<Alg>();
+            if (ordered.empty()) {
+                // The greedy rule got stuck, the windows are reoptimised from the EDD order instead.
+                ordered = GreedyHeuristics(mIns).ruleDueDates(true);
+            }
+
+            if (alg.create(ordered) == FeasibilityResult::FEASIBLE) {
+                startTimes = alg.getStartTimes();
+                result.setSolution(Solver::Result::Status::FEASIBLE, startTimes, obj.compute(mIns, startTimes));
+                cfg.publishIncumbent(result.getStartTimes(), result.getObjectiveValue());
+            }
+        }
+
+        const int windowSize = max(1, min(scfg.mWindowSize, numOperations));
+        const int windowStep = max(1, windowSize / 2);
+        const int numSlidingWindows = (numOperations - windowSize + windowStep - 1) / windowStep + 1;
+
+        BranchAndBoundOnOrder branchAndBound(mIns);
+        vector<int> congestedMeteringIntervals;
+        if (result.getStatus() == Solver::Result::Status::FEASIBLE) {
+            congestedMeteringIntervals = sortMeteringIntervalsByHeadroom(startTimes);
+        }
+        int nextCongested = 0;
+        int nextSlidingWindowStart = 0;
+        int numNonimprovingSlidingWindows = 0;
+        int numWindows = 0;
+        int numImprovingWindows = 0;
+        for (int iteration = 0; scfg.mNumIterations < 0 || iteration < scfg.mNumIterations; iteration++) {
+            if (deadline.reached() || numNonimprovingSlidingWindows >= numSlidingWindows) {
+                break;
+            }
+
+            int windowStart;
+            bool isSliding = iteration % 2 == 0 || nextCongested >= (int)congestedMeteringIntervals.size();
+            if (isSliding) {
+                windowStart = nextSlidingWindowStart;
+                nextSlidingWindowStart = windowStart + windowSize >= numOperations
+                                         ? 0 : min(windowStart + windowStep, numOperations - windowSize);
+            }
+            else {
+                windowStart = findCongestedWindowStart(ordered,
+                                                       startTimes,
+                                                       congestedMeteringIntervals[nextCongested++],
+                                                       windowSize);
+            }
+
+            auto remainingTime = cfg.getTimeLimit() - stopwatch.duration();
+            Solver::Config windowCfg(min(chrono::milliseconds(scfg.mWindowTimeLimit), remainingTime),
+                                     cfg.getObjective(),
+                                     false,
+                                     StartTimes(numOperations),
+                                     Solver::SpecialisedConfig(),
+                                     cfg.getFixedOrderEngine(),
+                                     cfg.getCancellationFlag());
+            auto windowResult = branchAndBound.solveWindow(windowCfg, ordered, windowStart, windowStart + windowSize);
+            numWindows++;
+
+            if (windowResult.getStatus() == Solver::Result::Status::FEASIBLE
+                || windowResult.getStatus() == Solver::Result::Status::OPTIMAL) {
+                startTimes = windowResult.getStartTimes();
+                ordered = startTimes.getOperationsOrdered(mIns);
+                result.setSolution(Solver::Result::Status::FEASIBLE, startTimes, windowResult.getObjectiveValue());
+                cfg.publishIncumbent(startTimes, windowResult.getObjectiveValue());
+
+                numImprovingWindows++;
+                numNonimprovingSlidingWindows = 0;
+                congestedMeteringIntervals = sortMeteringIntervalsByHeadroom(startTimes);
+                nextCongested = 0;
+            }
+            else if (isSliding) {
+                numNonimprovingSlidingWindows++;
+            }
+        }
+
+        result.setOptional("numWindows", to_string(numWindows));
+        result.setOptional("numImprovingWindows", to_string(numImprovingWindows));
+
+        stopwatch.stop();
+        result.setSolverRuntime(stopwatch.duration());
+        return result;
+    }
+
+    vector<int> LargeNeighbourhoodSearch::sortMeteringIntervalsByHeadroom(const StartTimes &startTimes) const {
+        EnergyProfile energyProfile(mIns);
+        for (const Operation *pOperation : mIns.getOperations()) {
+            energyProfile.insert(*pOperation, startTimes[*pOperation]);
+        }
+
+        vector<int> meteringIntervalIndices;
+        for (int meteringIntervalIndex = 0; meteringIntervalIndex < mIns.getNumMeteringIntervals(); meteringIntervalIndex++) {
+            if (energyProfile.getEnergyConsumption(meteringIntervalIndex) > 0.0) {
+                meteringIntervalIndices.push_back(meteringIntervalIndex);
+            }
+        }
+
+        stable_sort(meteringIntervalIndices.begin(), meteringIntervalIndices.end(), [&](const int lhs, const int rhs) {
+            return energyProfile.getHeadroom(lhs) < energyProfile.getHeadroom(rhs);
+        });
+
+        return meteringIntervalIndices;
+    }
+
+    int LargeNeighbourhoodSearch::findCongestedWindowStart(const vector<const Operation*> &ordered,
+                                                           const StartTimes &startTimes,
+                                                           const int meteringIntervalIndex,
+                                                           const int windowSize) const {
+        const MeteringInterval &meteringInterval = *mIns.getMeteringInterval(meteringIntervalIndex);
+        int firstPosition = -1;
+        int lastPosition = -1;
+        for (int position = 0; position < (int)ordered.size(); position++) {
+            const Operation &operation = *ordered[position];
+            int startTime = startTimes[operation];
+            if (startTime < meteringInterval.getEnd() && startTime + operation.getProcessingTime() > meteringInterval.getStart()) {
+                firstPosition = firstPosition == -1 ? position : firstPosition;
+                lastPosition = position;
+            }
+        }
+
+        int centerPosition = firstPosition == -1 ? 0 : (firstPosition + lastPosition) / 2;
+        return max(0, min(centerPosition - windowSize / 2, (int)ordered.size() - windowSize));
+    }
+}
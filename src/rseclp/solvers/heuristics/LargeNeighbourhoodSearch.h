@@ -0,0 +1,81 @@
+/*
+    
+    Copyright (C) 2017 Czech Technical University in Prague
+    The MIT License (MIT)
+    
+    Permission is hereby granted, free of charge, to any person obtaining
+    a copy of this software and associated documentation files
+    (the "Software"), to deal in the Software without restriction,
+    including without limitation the rights to use, copy, modify, merge,
+    publish, distribute, sublicense, and/or sell copies of the Software,
+    and to permit persons to whom the Software is furnished to do so,
+    subject to the following conditions:
+    
+    The above copyright notice and this permission notice shall be
+    included in all copies or substantial portions of the Software.
+    
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+    EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+    MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+    IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+    CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+    TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+    SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+#ifndef ROBUSTENERGYAWARESCHEDULING_LARGENEIGHBOURHOODSEARCH_H
+#define ROBUSTENERGYAWARESCHEDULING_LARGENEIGHBOURHOODSEARCH_H
+
+#include "../../instance/Instance.h"
+#include "../Solver.h"
+
+namespace rseclp {
+    using namespace std;
+
+    // Large neighbourhood search: the current order is kept except for a window of consecutive positions, which is
+    // reordered optimally by BranchAndBoundOnOrder. The windows alternate between sliding over the order and covering
+    // the operations of the metering intervals with the least energy headroom.
+    class LargeNeighbourhoodSearch : public Solver {
+    public:
+        static const string KEY_SOLVER;
+
+        class Config {
+        public:
+            static const string KEY_WINDOW_SIZE;
+            static const string KEY_WINDOW_TIME_LIMIT;
+            static const string KEY_NUM_ITERATIONS;
+
+            const int mWindowSize;
+            // Time limit of one window in milliseconds.
+            const int mWindowTimeLimit;
+            // Number of the searched windows, negative stops only when no sliding window improves the order.
+            const int mNumIterations;
+
+            Config(const int windowSize, const int windowTimeLimit, const int numIterations);
+
+            static Config createFrom(const Solver::Config &cfg);
+        };
+
+        LargeNeighbourhoodSearch(const Instance &ins);
+
+        virtual Solver::Result solve(const Solver::Config &cfg);
+
+    private:
+        const Instance &mIns;
+
+        template <typename Alg>
+        Solver::Result solveWith(const Solver::Config &cfg);
+
+        // Metering intervals intersected by the operations in the order of increasing headroom.
+        vector<int> sortMeteringIntervalsByHeadroom(const StartTimes &startTimes) const;
+
+        // Start of the window centered on the operations intersecting the metering interval.
+        int findCongestedWindowStart(const vector<const Operation*> &ordered,
+                                     const StartTimes &startTimes,
+                                     const int meteringIntervalIndex,
+                                     const int windowSize) const;
+    };
+}
+
+
+#endif //ROBUSTENERGYAWARESCHEDULING_LARGENEIGHBOURHOODSEARCH_H
@@ -26,8 +26,11 @@
 #include <iostream>
 #include "TabuSearch.h"
 #include "../../utils/Stopwatch.h"
+#include "../../utils/Deadline.h"
 #include "../../feasibility-checkers/FeasibilityChecker.h"
 #include "GreedyHeuristics.h"
+#include "../fixed-order/RobustScheduleFixedOrder2016B.h"
+#include "../fixed-order/RobustScheduleFixedOrderOptimised.h"
 
 namespace rseclp {
     const string TabuSearch::Config::KEY_NUM_RESTARTS = "numRestarts";
@@ -58,15 +61,28 @@ namespace rseclp {
 
     const string TabuSearch::KEY_SOLVER = "TabuSearch";
 
+    const int TabuSearch::NEIGHBOURHOOD_BATCH_SIZE = 64;
+
     TabuSearch::TabuSearch(const Instance &ins) : mIns(ins), mRandomEngine(42) {}
 
     Solver::Result TabuSearch::solve(const Solver::Config &cfg) {
+        if (cfg.getFixedOrderEngine() == FixedOrderEngine::FIXED_ORDER_OPTIMISED) {
+            return solveWith<RobustScheduleFixedOrderOptimised>(cfg);
+        }
+
+        return solveWith<RobustScheduleFixedOrder2016B>(cfg);
+    }
+
+    template <typename Alg>
+    Solver::Result TabuSearch::solveWith(const Solver::Config &cfg) {
         Stopwatch stopwatch;
         stopwatch.start();
+        Deadline deadline(cfg.getTimeLimit(), cfg.getCancellationFlag());
 
         auto scfg = TabuSearch::Config::createFrom(cfg);
 
         TotalTardiness obj;
+        BatchFixedOrderEvaluator<Alg> evaluator(mIns, obj);
         Solver::Result result(mIns.getNumOperations(), obj.worstValue());
         if (cfg.getUseInitStartTimes() && FeasibilityChecker(mIns).areFeasible(cfg.getInitStartTimes())) {
             result.setSolution(Solver::Result::Status::FEASIBLE,
@@ -74,21 +90,34 @@ namespace rseclp {
                                obj.compute(mIns, cfg.getInitStartTimes()));
         }
 
+        // The first restart continues from the incumbent if it is better than the initial solution.
+        StartTimes incumbentStartTimes;
+        double incumbentObjVal;
+        bool useIncumbent = cfg.testAndGetBetterIncumbent(result.getObjectiveValue(), incumbentStartTimes, incumbentObjVal);
+        if (useIncumbent) {
+            result.setSolution(Solver::Result::Status::FEASIBLE, incumbentStartTimes, incumbentObjVal);
+        }
+
         for (int restart = 0; restart < scfg.mNumRestarts; restart++) {
-            if (stopwatch.timeLimitReached(cfg.getTimeLimit())) {
+            if (deadline.reached()) {
                 break;
             }
 
             vector<const Operation*> ordered;
             bool isFeasible;
             StartTimes startTimes;
-            if (restart == 0 && cfg.getUseInitStartTimes()) {
+            if (restart == 0 && useIncumbent) {
+                startTimes = incumbentStartTimes;
+                ordered = startTimes.getOperationsOrdered(mIns);
+                isFeasible = true;
+            }
+            else if (restart == 0 && cfg.getUseInitStartTimes()) {
                 startTimes = cfg.getInitStartTimes();
                 ordered = startTimes.getOperationsOrdered(mIns);
                 isFeasible = FeasibilityChecker(mIns).areFeasible(startTimes);
             }
             else {
-                RobustScheduleFixedOrderDefault alg(mIns);
+                Alg alg(mIns);
                 ordered = GreedyHeuristics(mIns).ruleRandom();
                 isFeasible = alg.create(ordered) == FeasibilityResult::FEASIBLE;
                 startTimes = alg.getStartTimes();
@@ -97,14 +126,13 @@ namespace rseclp {
             double objVal = obj.compute(mIns, startTimes);
             Solution startSolution(move(ordered), move(startTimes), isFeasible, isFeasible ? objVal : obj.worstValue());
 
-            auto restartSolution = newRestart(cfg, scfg, startSolution, stopwatch);
+            auto restartSolution = newRestart<Alg>(cfg, scfg, startSolution, evaluator, deadline);
             if (result.getStatus() == Solver::Result::Status::NO_SOLUTION
                 || (restartSolution.mIsFeasible && obj.isBetter(restartSolution.mObjectiveValue, result.getObjectiveValue()))) {
                 auto status = restartSolution.mIsFeasible ? Solver::Result::Status::FEASIBLE : Solver::Result::Status::NO_SOLUTION;
                 result.setSolution(status,
                                    move(restartSolution.mStartTimes),
                                    restartSolution.mObjectiveValue);
-//                cout << "New best objective: " << result.getObjectiveValue() << endl;
             }
         }
 
@@ -114,10 +142,12 @@ namespace rseclp {
         return result;
     }
 
+    template <typename Alg>
     TabuSearch::Solution TabuSearch::newRestart(const Solver::Config &cfg,
                                                 const TabuSearch::Config &scfg,
                                                 const TabuSearch::Solution &startSolution,
-                                                Stopwatch &stopwatch) {
+                                                BatchFixedOrderEvaluator<Alg> &evaluator,
+                                                Deadline &deadline) {
         vector<vector<const Operation*>> tabuList;
         Solution bestSolution(startSolution.mOrdered,
                               startSolution.mStartTimes,
@@ -130,13 +160,14 @@ namespace rseclp {
         int iteration = 0;
         int numNonimprovingIterations = 0;
         while (iteration < scfg.mNumIterations) {
-            if (stopwatch.timeLimitReached(cfg.getTimeLimit())) {
+            if (deadline.reached()) {
                 break;
             }
 
-            auto candidateSolution = neighbourhoodSearch(cfg, scfg, currentSolution, bestSolution, tabuList, stopwatch);
+            auto candidateSolution = neighbourhoodSearch<Alg>(cfg, scfg, currentSolution, bestSolution, tabuList, evaluator, deadline);
             if (candidateSolution.mIsFeasible && cfg.getObjective()->isBetter(candidateSolution.mObjectiveValue, bestSolution.mObjectiveValue)) {
                 bestSolution = candidateSolution;
+                cfg.publishIncumbent(bestSolution.mStartTimes, bestSolution.mObjectiveValue);
                 numNonimprovingIterations = 0;
             }
             else {
@@ -162,12 +193,14 @@ namespace rseclp {
         return bestSolution;
     }
 
+    template <typename Alg>
     TabuSearch::Solution TabuSearch::neighbourhoodSearch(const Solver::Config &cfg,
                                                          const Config &scfg,
                                                          const Solution &currentSolution,
                                                          const Solution &bestSolution,
                                                          vector<vector<const Operation*>> &tabuList,
-                                                         Stopwatch &stopwatch) {
+                                                         BatchFixedOrderEvaluator<Alg> &evaluator,
+                                                         Deadline &deadline) {
         Solution neighbourhoodBestSolution;
 
         vector<CandidateGenerator<default_random_engine>*> candidateGenerators = {
@@ -176,25 +209,34 @@ namespace rseclp {
         };
 
         uniform_int_distribution<int> candidateGeneratorDist(0, (int)candidateGenerators.size() - 1);
-        for (int iter = 0; iter < scfg.mNeighbourhoodSize && !stopwatch.timeLimitReached(cfg.getTimeLimit()); iter++) {
-            auto &candidateGenerator = *candidateGenerators[candidateGeneratorDist(mRandomEngine)];
-            auto candidateSolution = candidateGenerator.randomCandidate(mRandomEngine);
-
-            if (!candidateSolution.mIsFeasible) {
-                continue;
+        int iter = 0;
+        while (iter < scfg.mNeighbourhoodSize && !deadline.reached()) {
+            evaluator.clear();
+            for (; iter < scfg.mNeighbourhoodSize && evaluator.getNumOrders() < NEIGHBOURHOOD_BATCH_SIZE; iter++) {
+                auto &candidateGenerator = *candidateGenerators[candidateGeneratorDist(mRandomEngine)];
+                evaluator.addOrder(candidateGenerator.randomCandidate(mRandomEngine));
             }
+            evaluator.evaluate();
 
-            bool candidateBetterThanBest = candidateSolution.mObjectiveValue < bestSolution.mObjectiveValue;
-            bool candidateBetterThanBestNeighbourhood = candidateSolution.mObjectiveValue < neighbourhoodBestSolution.mObjectiveValue;
-            if (candidateBetterThanBest && candidateBetterThanBestNeighbourhood) {
-                neighbourhoodBestSolution = move(candidateSolution);
-            }
-            else {
-                if (isTabu(cfg, scfg, candidateSolution.mOrdered, tabuList)) {
+            for (int candidate = 0; candidate < evaluator.getNumOrders(); candidate++) {
+                if (!evaluator.isFeasible(candidate)) {
                     continue;
                 }
-                else if (candidateBetterThanBestNeighbourhood) {
-                    neighbourhoodBestSolution = move(candidateSolution);
+
+                double objVal = evaluator.getObjectiveValue(candidate);
+                bool candidateBetterThanBest = objVal < bestSolution.mObjectiveValue;
+                bool candidateBetterThanBestNeighbourhood = objVal < neighbourhoodBestSolution.mObjectiveValue;
+                if (candidateBetterThanBest && candidateBetterThanBestNeighbourhood) {
+                    neighbourhoodBestSolution = Solution(evaluator.getOrdered(candidate), evaluator.getStartTimes(candidate), true, objVal);
+                }
+                else {
+                    auto ordered = evaluator.getOrdered(candidate);
+                    if (isTabu(cfg, scfg, ordered, tabuList)) {
+                        continue;
+                    }
+                    else if (candidateBetterThanBestNeighbourhood) {
+                        neighbourhoodBestSolution = Solution(move(ordered), evaluator.getStartTimes(candidate), true, objVal);
+                    }
                 }
             }
         }
@@ -29,11 +29,11 @@
 #include <random>
 #include "../../instance/Instance.h"
 #include "../Solver.h"
-#include "../fixed-order/RobustScheduleFixedOrderDefault.h"
 #include "../../feasibility-checkers/FeasibilityChecker.h"
 #include "../../objectives/TotalTardiness.h"
-#include "../../utils/Stopwatch.h"
+#include "../../utils/Deadline.h"
 #include "../../utils/GeneralUtils.h"
+#include "../fixed-order/BatchFixedOrderEvaluator.h"
 
 namespace rseclp {
     class TabuSearch : public Solver {
@@ -86,7 +86,7 @@ namespace rseclp {
         class CandidateGenerator {
         public:
             virtual ~CandidateGenerator() {}
-            virtual Solution randomCandidate(RNG &randomEngine) = 0;
+            virtual vector<const Operation*> randomCandidate(RNG &randomEngine) = 0;
         };
 
         template <typename RNG>
@@ -95,17 +95,12 @@ namespace rseclp {
             const Instance &mIns;
             const Solution &mCurrentSolution;
 
-            Solution generateForPositions(int position, int newPosition) {
+            vector<const Operation*> generateForPositions(int position, int newPosition) {
                 vector<const Operation*> ordered(mCurrentSolution.mOrdered);
                 auto *pOperation = ordered[position];
                 ordered.erase(ordered.begin() + position);
                 ordered.insert(ordered.begin() + newPosition, pOperation);
-
-                RobustScheduleFixedOrderDefault alg(mIns);
-                auto feasibilityResult = alg.create(ordered);
-
-                double objVal = TotalTardiness().compute(mIns, alg.getStartTimes());
-                return Solution(move(ordered), alg.getStartTimes(), feasibilityResult == FeasibilityResult::FEASIBLE, objVal);
+                return ordered;
             }
 
         public:
@@ -113,7 +108,7 @@ namespace rseclp {
             InsertCandidateGenerator(const Instance &ins, const Solution &currentSolution)
                     : mIns(ins), mCurrentSolution(currentSolution) {}
 
-            virtual Solution randomCandidate(RNG &randomEngine) {
+            virtual vector<const Operation*> randomCandidate(RNG &randomEngine) {
                 auto values = GeneralUtils::twoDifferentRandomIntegers(0, mIns.getNumOperations() - 1, randomEngine);
                 return generateForPositions(values.first, values.second);
             }
@@ -125,15 +120,10 @@ namespace rseclp {
             const Instance &mIns;
             const Solution &mCurrentSolution;
 
-            Solution generateForPositions(int position1, int position2) {
+            vector<const Operation*> generateForPositions(int position1, int position2) {
                 vector<const Operation*> ordered(mCurrentSolution.mOrdered);
                 iter_swap(ordered.begin() + position1, ordered.begin() + position2);
-
-                RobustScheduleFixedOrderDefault alg(mIns);
-                auto feasibilityResult = alg.create(ordered);
-
-                double objVal = TotalTardiness().compute(mIns, alg.getStartTimes());
-                return Solution(move(ordered), alg.getStartTimes(), feasibilityResult == FeasibilityResult::FEASIBLE, objVal);
+                return ordered;
             }
 
         public:
@@ -141,27 +131,37 @@ namespace rseclp {
             SwapCandidateGenerator(const Instance &ins, const Solution &currentSolution)
                     : mIns(ins), mCurrentSolution(currentSolution) {}
 
-            virtual Solution randomCandidate(RNG &randomEngine) {
+            virtual vector<const Operation*> randomCandidate(RNG &randomEngine) {
                 auto values = GeneralUtils::twoDifferentRandomIntegers(0, mIns.getNumOperations() - 1, randomEngine);
                 return generateForPositions(values.first, values.second);
             }
         };
 
     private:
+        // Neighbourhood candidates are evaluated in batches of this size, the deadline is checked between them.
+        static const int NEIGHBOURHOOD_BATCH_SIZE;
+
         const Instance &mIns;
         default_random_engine mRandomEngine;
 
+        template <typename Alg>
+        Solver::Result solveWith(const Solver::Config &cfg);
+
+        template <typename Alg>
         Solution newRestart(const Solver::Config &cfg,
                             const Config &scfg,
                             const Solution &startSolution,
-                            Stopwatch &stopwatch);
+                            BatchFixedOrderEvaluator<Alg> &evaluator,
+                            Deadline &deadline);
 
+        template <typename Alg>
         Solution neighbourhoodSearch(const Solver::Config &cfg,
                                      const Config &scfg,
                                      const Solution &currentSolution,
                                      const Solution &bestSolution,
                                      vector<vector<const Operation*>> &tabuList,
-                                     Stopwatch &stopwatch);
+                                     BatchFixedOrderEvaluator<Alg> &evaluator,
+                                     Deadline &deadline);
 
         bool isTabu(const Solver::Config &cfg,
                     const Config &scfg,
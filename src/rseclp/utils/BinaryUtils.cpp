@@ -0,0 +1,71 @@
+/*
+    
+    Copyright (C) 2017 Czech Technical University in Prague
+    The MIT License (MIT)
+    
+    Permission is hereby granted, free of charge, to any person obtaining
+    a copy of this software and associated documentation files
+    (the "Software"), to deal in the Software without restriction,
+    including without limitation the rights to use, copy, modify, merge,
+    publish, distribute, sublicense, and/or sell copies of the Software,
+    and to permit persons to whom the Software is furnished to do so,
+    subject to the following conditions:
+    
+    The above copyright notice and this permission notice shall be
+    included in all copies or substantial portions of the Software.
+    
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+    EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+    MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+    IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+    CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+    TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+    SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+#include "BinaryUtils.h"
+
+namespace rseclp {
+
+    bool BinaryUtils::hasMagic(const char *data, size_t size, const char *magic) {
+        size_t magicLength = strlen(magic);
+        return size >= magicLength && memcmp(data, magic, magicLength) == 0;
+    }
+
+    void BinaryUtils::ensureAvailable(const char *cursor, const char *end, size_t numBytes) {
+        if (static_cast<size_t>(end - cursor) < numBytes) {
+            throw std::invalid_argument("Binary data are truncated.");
+        }
+    }
+
+    void BinaryUtils::writeStringMap(ostream &out, const map<string, string> &values) {
+        for (auto &entry : values) {
+            writeValue(out, static_cast<uint32_t>(entry.first.size()));
+            out.write(entry.first.data(), static_cast<streamsize>(entry.first.size()));
+            writeValue(out, static_cast<uint32_t>(entry.second.size()));
+            out.write(entry.second.data(), static_cast<streamsize>(entry.second.size()));
+        }
+    }
+
+    map<string, string> BinaryUtils::readStringMap(const char *&cursor, const char *end, uint32_t numEntries) {
+        map<string, string> values;
+        for (uint32_t entryIndex = 0; entryIndex < numEntries; entryIndex++) {
+            auto keyLength = readValue<uint32_t>(cursor, end);
+            ensureAvailable(cursor, end, keyLength);
+            string key(cursor, keyLength);
+            cursor += keyLength;
+
+            auto valueLength = readValue<uint32_t>(cursor, end);
+            ensureAvailable(cursor, end, valueLength);
+            values[move(key)] = string(cursor, valueLength);
+            cursor += valueLength;
+        }
+        return values;
+    }
+
+    void BinaryUtils::writePadding(ostream &out, size_t numBytes) {
+        for (size_t i = 0; i < numBytes; i++) {
+            out.put('\0');
+        }
+    }
+}
@@ -0,0 +1,91 @@
+/*
+    
+    Copyright (C) 2017 Czech Technical University in Prague
+    The MIT License (MIT)
+    
+    Permission is hereby granted, free of charge, to any person obtaining
+    a copy of this software and associated documentation files
+    (the "Software"), to deal in the Software without restriction,
+    including without limitation the rights to use, copy, modify, merge,
+    publish, distribute, sublicense, and/or sell copies of the Software,
+    and to permit persons to whom the Software is furnished to do so,
+    subject to the following conditions:
+    
+    The above copyright notice and this permission notice shall be
+    included in all copies or substantial portions of the Software.
+    
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+    EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+    MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+    IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+    CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+    TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+    SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+#ifndef ROBUSTENERGYAWARESCHEDULING_BINARYUTILS_H
+#define ROBUSTENERGYAWARESCHEDULING_BINARYUTILS_H
+
+#include <cstdint>
+#include <cstring>
+#include <map>
+#include <string>
+#include <ostream>
+#include <stdexcept>
+
+namespace rseclp {
+
+    using namespace std;
+
+    // Helpers for the binary file formats. Values are stored in the native byte order. Arrays are not parsed but viewed
+    // in the memory mapped file and copied once into the instance or result, therefore the writers keep every array
+    // aligned to its element size.
+    class BinaryUtils {
+    public:
+        static const size_t ALIGNMENT = 8;
+
+        static bool hasMagic(const char *data, size_t size, const char *magic);
+
+        static void ensureAvailable(const char *cursor, const char *end, size_t numBytes);
+
+        static void writeStringMap(ostream &out, const map<string, string> &values);
+
+        static map<string, string> readStringMap(const char *&cursor, const char *end, uint32_t numEntries);
+
+        static void writePadding(ostream &out, size_t numBytes);
+
+        template <typename T>
+        static void writeValue(ostream &out, const T &value) {
+            out.write(reinterpret_cast<const char*>(&value), sizeof(T));
+        }
+
+        template <typename T>
+        static void writeArray(ostream &out, const T *values, size_t count) {
+            out.write(reinterpret_cast<const char*>(values), static_cast<streamsize>(count * sizeof(T)));
+        }
+
+        template <typename T>
+        static const T *readArray(const char *&cursor, const char *end, size_t count) {
+            ensureAvailable(cursor, end, count * sizeof(T));
+            if (reinterpret_cast<uintptr_t>(cursor) % alignof(T) != 0) {
+                throw std::invalid_argument("Binary data are not aligned.");
+            }
+            const T *values = reinterpret_cast<const T*>(cursor);
+            cursor += count * sizeof(T);
+            return values;
+        }
+
+        template <typename T>
+        static T readValue(const char *&cursor, const char *end) {
+            ensureAvailable(cursor, end, sizeof(T));
+            T value;
+            memcpy(&value, cursor, sizeof(T));
+            cursor += sizeof(T);
+            return value;
+        }
+    };
+
+}
+
+
+#endif //ROBUSTENERGYAWARESCHEDULING_BINARYUTILS_H
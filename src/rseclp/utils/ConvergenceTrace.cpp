@@ -0,0 +1,91 @@
+/*
+    
+    Copyright (C) 2017 Czech Technical University in Prague
+    The MIT License (MIT)
+    
+    Permission is hereby granted, free of charge, to any person obtaining
+    a copy of this software and associated documentation files
+    (the "Software"), to deal in the Software without restriction,
+    including without limitation the rights to use, copy, modify, merge,
+    publish, distribute, sublicense, and/or sell copies of the Software,
+    and to permit persons to whom the Software is furnished to do so,
+    subject to the following conditions:
+    
+    The above copyright notice and this permission notice shall be
+    included in all copies or substantial portions of the Software.
+    
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+    EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+    MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+    IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+    CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+    TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+    SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+#include <stdexcept>
+#include "ConvergenceTrace.h"
+
+namespace rseclp {
+
+    ConvergenceTrace::ConvergenceTrace(const int capacity) {
+        if (capacity <= 0) {
+            throw invalid_argument("Capacity of the convergence trace has to be positive.");
+        }
+
+        mEntries.resize(capacity);
+        start();
+    }
+
+    void ConvergenceTrace::start() {
+        lock_guard<mutex> lock(mMutex);
+        mStart = chrono::steady_clock::now();
+        mNext = 0;
+        mSize = 0;
+        mLast = Entry{chrono::milliseconds(0), false, 0.0, false, 0.0};
+    }
+
+    bool ConvergenceTrace::recordObjectiveValue(const Objective &objective, const double objectiveValue) {
+        lock_guard<mutex> lock(mMutex);
+        if (mLast.mHasObjectiveValue && !objective.isBetter(objectiveValue, mLast.mObjectiveValue)) {
+            return false;
+        }
+
+        mLast.mHasObjectiveValue = true;
+        mLast.mObjectiveValue = objectiveValue;
+        record();
+        return true;
+    }
+
+    bool ConvergenceTrace::recordBound(const Objective &objective, const double bound) {
+        lock_guard<mutex> lock(mMutex);
+        // The bound is tighter if the previous one is better than it.
+        if (mLast.mHasBound && !objective.isBetter(mLast.mBound, bound)) {
+            return false;
+        }
+
+        mLast.mHasBound = true;
+        mLast.mBound = bound;
+        record();
+        return true;
+    }
+
+    vector<ConvergenceTrace::Entry> ConvergenceTrace::getEntries() const {
+        lock_guard<mutex> lock(mMutex);
+        vector<Entry> entries;
+        entries.reserve(mSize);
+        int capacity = (int)mEntries.size();
+        for (int index = mNext - mSize + capacity; index < mNext + capacity; index++) {
+            entries.push_back(mEntries[index % capacity]);
+        }
+
+        return entries;
+    }
+
+    void ConvergenceTrace::record() {
+        mLast.mTime = chrono::duration_cast<chrono::milliseconds>(chrono::steady_clock::now() - mStart);
+        mEntries[mNext] = mLast;
+        mNext = (mNext + 1) % (int)mEntries.size();
+        mSize = min(mSize + 1, (int)mEntries.size());
+    }
+}
@@ -0,0 +1,80 @@
+/*
+    
+    Copyright (C) 2017 Czech Technical University in Prague
+    The MIT License (MIT)
+    
+    Permission is hereby granted, free of charge, to any person obtaining
+    a copy of this software and associated documentation files
+    (the "Software"), to deal in the Software without restriction,
+    including without limitation the rights to use, copy, modify, merge,
+    publish, distribute, sublicense, and/or sell copies of the Software,
+    and to permit persons to whom the Software is furnished to do so,
+    subject to the following conditions:
+    
+    The above copyright notice and this permission notice shall be
+    included in all copies or substantial portions of the Software.
+    
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+    EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+    MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+    IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+    CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+    TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+    SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+#ifndef ROBUSTENERGYAWARESCHEDULING_CONVERGENCETRACE_H
+#define ROBUSTENERGYAWARESCHEDULING_CONVERGENCETRACE_H
+
+#include <chrono>
+#include <mutex>
+#include <vector>
+#include "../objectives/Objective.h"
+
+namespace rseclp {
+
+    using namespace std;
+
+    // Trajectory of the best objective value and bound over the run. The entries are kept in a preallocated ring
+    // buffer, so the recording never allocates and only the latest entries are kept when the capacity is exceeded.
+    class ConvergenceTrace {
+    public:
+        class Entry {
+        public:
+            // Elapsed since the start of the trace.
+            chrono::milliseconds mTime;
+            bool mHasObjectiveValue;
+            double mObjectiveValue;
+            bool mHasBound;
+            double mBound;
+        };
+
+        ConvergenceTrace(const int capacity);
+
+        // Clears the entries and restarts the clock.
+        void start();
+
+        // Records the value if it improves the best one, returns true if recorded.
+        bool recordObjectiveValue(const Objective &objective, const double objectiveValue);
+
+        // Records the bound if it is tighter than the best one, returns true if recorded.
+        bool recordBound(const Objective &objective, const double bound);
+
+        // Entries from the oldest one.
+        vector<Entry> getEntries() const;
+
+    private:
+        mutable mutex mMutex;
+        chrono::time_point<chrono::steady_clock> mStart;
+        vector<Entry> mEntries;
+        int mNext;
+        int mSize;
+        Entry mLast;
+
+        void record();
+    };
+
+}
+
+
+#endif //ROBUSTENERGYAWARESCHEDULING_CONVERGENCETRACE_H
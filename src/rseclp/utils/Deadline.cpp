@@ -0,0 +1,63 @@
+/*
+    
+    Copyright (C) 2017 Czech Technical University in Prague
+    The MIT License (MIT)
+    
+    Permission is hereby granted, free of charge, to any person obtaining
+    a copy of this software and associated documentation files
+    (the "Software"), to deal in the Software without restriction,
+    including without limitation the rights to use, copy, modify, merge,
+    publish, distribute, sublicense, and/or sell copies of the Software,
+    and to permit persons to whom the Software is furnished to do so,
+    subject to the following conditions:
+    
+    The above copyright notice and this permission notice shall be
+    included in all copies or substantial portions of the Software.
+    
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+    EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+    MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+    IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+    CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+    TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+    SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+#include <algorithm>
+#include "Deadline.h"
+
+namespace rseclp {
+
+    const chrono::microseconds Deadline::CHECK_INTERVAL = chrono::microseconds(500);
+    const int Deadline::MAX_CHECK_PERIOD = 1 << 16;
+
+    Deadline::Deadline(const chrono::milliseconds &timeLimit, const atomic<bool> *cancellationFlag)
+            : mDeadline(chrono::steady_clock::now() + timeLimit),
+              mLastCheck(chrono::steady_clock::now()),
+              mCancellationFlag(cancellationFlag),
+              mCheckPeriod(1),
+              mCallsUntilCheck(1),
+              mReached(false) {}
+
+    bool Deadline::check() {
+        auto now = chrono::steady_clock::now();
+        if (now > mDeadline || (mCancellationFlag != nullptr && mCancellationFlag->load(memory_order_relaxed))) {
+            mReached = true;
+            return true;
+        }
+
+        // Double or halve the period depending on how long did the last batch take.
+        auto elapsed = now - mLastCheck;
+        if (elapsed < CHECK_INTERVAL / 2) {
+            mCheckPeriod = min(2 * mCheckPeriod, MAX_CHECK_PERIOD);
+        }
+        else if (elapsed > 2 * CHECK_INTERVAL) {
+            mCheckPeriod = max(mCheckPeriod / 2, 1);
+        }
+
+        mLastCheck = now;
+        mCallsUntilCheck = mCheckPeriod;
+        return false;
+    }
+
+}
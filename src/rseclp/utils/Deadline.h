@@ -0,0 +1,71 @@
+/*
+    
+    Copyright (C) 2017 Czech Technical University in Prague
+    The MIT License (MIT)
+    
+    Permission is hereby granted, free of charge, to any person obtaining
+    a copy of this software and associated documentation files
+    (the "Software"), to deal in the Software without restriction,
+    including without limitation the rights to use, copy, modify, merge,
+    publish, distribute, sublicense, and/or sell copies of the Software,
+    and to permit persons to whom the Software is furnished to do so,
+    subject to the following conditions:
+    
+    The above copyright notice and this permission notice shall be
+    included in all copies or substantial portions of the Software.
+    
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+    EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+    MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+    IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+    CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+    TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+    SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+#ifndef ROBUSTENERGYAWARESCHEDULING_DEADLINE_H
+#define ROBUSTENERGYAWARESCHEDULING_DEADLINE_H
+
+#include <chrono>
+#include <atomic>
+
+namespace rseclp {
+
+    using namespace std;
+
+    // Time limit (and cancellation) check for the search loops. The clock is read only once per batch of calls,
+    // the batch size adapts so that the clock is read approximately every CHECK_INTERVAL.
+    class Deadline {
+    private:
+        static const chrono::microseconds CHECK_INTERVAL;
+        static const int MAX_CHECK_PERIOD;
+
+        chrono::time_point<chrono::steady_clock> mDeadline;
+        chrono::time_point<chrono::steady_clock> mLastCheck;
+        const atomic<bool> *mCancellationFlag;
+        int mCheckPeriod;
+        int mCallsUntilCheck;
+        bool mReached;
+
+        bool check();
+
+    public:
+        Deadline(const chrono::milliseconds &timeLimit, const atomic<bool> *cancellationFlag = nullptr);
+
+        bool reached() {
+            if (mReached) {
+                return true;
+            }
+
+            if (--mCallsUntilCheck > 0) {
+                return false;
+            }
+
+            return check();
+        }
+    };
+
+}
+
+
+#endif //ROBUSTENERGYAWARESCHEDULING_DEADLINE_H
@@ -0,0 +1,173 @@
+/*
+    
+    Copyright (C) 2017 Czech Technical University in Prague
+    The MIT License (MIT)
+    
+    Permission is hereby granted, free of charge, to any person obtaining
+    a copy of this software and associated documentation files
+    (the "Software"), to deal in the Software without restriction,
+    including without limitation the rights to use, copy, modify, merge,
+    publish, distribute, sublicense, and/or sell copies of the Software,
+    and to permit persons to whom the Software is furnished to do so,
+    subject to the following conditions:
+    
+    The above copyright notice and this permission notice shall be
+    included in all copies or substantial portions of the Software.
+    
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+    EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+    MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+    IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+    CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+    TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+    SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+#include <algorithm>
+#include "EnergyProfile.h"
+#include "GeneralUtils.h"
+
+namespace rseclp {
+
+    EnergyProfile::EnergyProfile(const Instance &ins)
+            : mIns(ins),
+              mEnergyConsumptions(ins.getNumMeteringIntervals(), 0.0),
+              mNumOperations(ins.getNumMeteringIntervals(), 0) {}
+
+    void EnergyProfile::clear() {
+        fill(mEnergyConsumptions.begin(), mEnergyConsumptions.end(), 0.0);
+        fill(mNumOperations.begin(), mNumOperations.end(), 0);
+    }
+
+    int EnergyProfile::firstMeteringIntervalIndex(const int startTime) const {
+        return min(mIns.getNumMeteringIntervals(), max(0, startTime) / mIns.getLengthMeteringInterval());
+    }
+
+    int EnergyProfile::lastMeteringIntervalIndex(const int completionTime) const {
+        if (completionTime <= 0) {
+            return -1;
+        }
+        return min(mIns.getNumMeteringIntervals() - 1, (completionTime - 1) / mIns.getLengthMeteringInterval());
+    }
+
+    void EnergyProfile::addEnergyConsumption(const int start, const int end, const double powerConsumption) {
+        if (end <= start) {
+            return;
+        }
+
+        const int lastIndex = lastMeteringIntervalIndex(end);
+        for (int meteringIntervalIndex = firstMeteringIntervalIndex(start); meteringIntervalIndex <= lastIndex; meteringIntervalIndex++) {
+            const MeteringInterval &meteringInterval = *mIns.getMeteringInterval(meteringIntervalIndex);
+            int intersection = GeneralUtils::computeIntervalsIntersectionLength(meteringInterval.getStart(),
+                                                                                meteringInterval.getEnd(),
+                                                                                start,
+                                                                                end);
+            mEnergyConsumptions[meteringIntervalIndex] += intersection * powerConsumption;
+        }
+    }
+
+    void EnergyProfile::addMembership(const int fromIndex, const int toIndex, const int delta) {
+        for (int meteringIntervalIndex = fromIndex; meteringIntervalIndex <= toIndex; meteringIntervalIndex++) {
+            mNumOperations[meteringIntervalIndex] += delta;
+            if (mNumOperations[meteringIntervalIndex] == 0) {
+                mEnergyConsumptions[meteringIntervalIndex] = 0.0;
+            }
+        }
+    }
+
+    void EnergyProfile::insert(const Operation &operation, const int startTime) {
+        const int completionTime = startTime + operation.getProcessingTime();
+        addEnergyConsumption(startTime, completionTime, operation.getPowerConsumption());
+        addMembership(firstMeteringIntervalIndex(startTime), lastMeteringIntervalIndex(completionTime), 1);
+    }
+
+    void EnergyProfile::remove(const Operation &operation, const int startTime) {
+        const int completionTime = startTime + operation.getProcessingTime();
+        addEnergyConsumption(startTime, completionTime, -operation.getPowerConsumption());
+        addMembership(firstMeteringIntervalIndex(startTime), lastMeteringIntervalIndex(completionTime), -1);
+    }
+
+    void EnergyProfile::shift(const Operation &operation, const int fromStartTime, const int toStartTime) {
+        const int processingTime = operation.getProcessingTime();
+        if (fromStartTime == toStartTime) {
+            return;
+        }
+        else if (toStartTime >= fromStartTime + processingTime || fromStartTime >= toStartTime + processingTime) {
+            remove(operation, fromStartTime);
+            insert(operation, toStartTime);
+            return;
+        }
+
+        // Only the non-overlapping parts of the old and the new execution change the energy.
+        const double powerConsumption = operation.getPowerConsumption();
+        if (fromStartTime < toStartTime) {
+            addEnergyConsumption(fromStartTime, toStartTime, -powerConsumption);
+            addEnergyConsumption(fromStartTime + processingTime, toStartTime + processingTime, powerConsumption);
+        }
+        else {
+            addEnergyConsumption(toStartTime, fromStartTime, powerConsumption);
+            addEnergyConsumption(toStartTime + processingTime, fromStartTime + processingTime, -powerConsumption);
+        }
+
+        const int fromFirstIndex = firstMeteringIntervalIndex(fromStartTime);
+        const int fromLastIndex = lastMeteringIntervalIndex(fromStartTime + processingTime);
+        const int toFirstIndex = firstMeteringIntervalIndex(toStartTime);
+        const int toLastIndex = lastMeteringIntervalIndex(toStartTime + processingTime);
+        addMembership(toFirstIndex, fromFirstIndex - 1, 1);
+        addMembership(fromLastIndex + 1, toLastIndex, 1);
+        addMembership(fromFirstIndex, toFirstIndex - 1, -1);
+        addMembership(toLastIndex + 1, fromLastIndex, -1);
+    }
+
+    double EnergyProfile::getEnergyConsumption(const int meteringIntervalIndex) const {
+        return mEnergyConsumptions[meteringIntervalIndex];
+    }
+
+    double EnergyProfile::getHeadroom(const int meteringIntervalIndex) const {
+        return mIns.getMeteringInterval(meteringIntervalIndex)->getMaxEnergyConsumption() - mEnergyConsumptions[meteringIntervalIndex];
+    }
+
+    const MeteringInterval *EnergyProfile::findViolatedMeteringInterval(const double tolerance) const {
+        return findViolatedMeteringInterval(0, mIns.getNumMeteringIntervals() - 1, tolerance);
+    }
+
+    const MeteringInterval *EnergyProfile::findViolatedMeteringInterval(const int fromIndex,
+                                                                        const int toIndex,
+                                                                        const double tolerance) const {
+        for (int meteringIntervalIndex = max(0, fromIndex); meteringIntervalIndex <= min(mIns.getNumMeteringIntervals() - 1, toIndex); meteringIntervalIndex++) {
+            const MeteringInterval *pMeteringInterval = mIns.getMeteringInterval(meteringIntervalIndex);
+            if (GeneralUtils::isGreater(mEnergyConsumptions[meteringIntervalIndex],
+                                        pMeteringInterval->getMaxEnergyConsumption(),
+                                        tolerance)) {
+                return pMeteringInterval;
+            }
+        }
+
+        return nullptr;
+    }
+
+    double EnergyProfile::computeEnergyConsumption(const vector<const Operation*> &ordered,
+                                                   const StartTimes &startTimes,
+                                                   const int fromPosition,
+                                                   const int upToPosition,
+                                                   const MeteringInterval &meteringInterval) {
+        double energyConsumption = 0.0;
+        for (int position = upToPosition; position >= fromPosition; position--) {
+            const Operation &operation = *ordered[position];
+            int startTime = startTimes[operation];
+            int completionTime = startTime + operation.getProcessingTime();
+
+            if (completionTime <= meteringInterval.getStart()) {
+                break;
+            }
+
+            int intersection = GeneralUtils::computeIntervalsIntersectionLength(meteringInterval.getStart(),
+                                                                                meteringInterval.getEnd(),
+                                                                                startTime,
+                                                                                completionTime);
+            energyConsumption += intersection * operation.getPowerConsumption();
+        }
+
+        return energyConsumption;
+    }
+}
@@ -0,0 +1,86 @@
+/*
+    
+    Copyright (C) 2017 Czech Technical University in Prague
+    The MIT License (MIT)
+    
+    Permission is hereby granted, free of charge, to any person obtaining
+    a copy of this software and associated documentation files
+    (the "Software"), to deal in the Software without restriction,
+    including without limitation the rights to use, copy, modify, merge,
+    publish, distribute, sublicense, and/or sell copies of the Software,
+    and to permit persons to whom the Software is furnished to do so,
+    subject to the following conditions:
+    
+    The above copyright notice and this permission notice shall be
+    included in all copies or substantial portions of the Software.
+    
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+    EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+    MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+    IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+    CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+    TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+    SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+#ifndef ROBUSTENERGYAWARESCHEDULING_ENERGYPROFILE_H
+#define ROBUSTENERGYAWARESCHEDULING_ENERGYPROFILE_H
+
+#include "../instance/Instance.h"
+#include "StartTimes.h"
+
+namespace rseclp {
+    using namespace std;
+
+    // Energy consumption of the scheduled operations in every metering interval, maintained under insertion,
+    // removal and shifting of the operations.
+    class EnergyProfile {
+    private:
+        const Instance &mIns;
+
+        vector<double> mEnergyConsumptions;
+        // Number of operations intersecting the metering interval, an empty interval is reset to exactly zero.
+        vector<int> mNumOperations;
+
+        int firstMeteringIntervalIndex(const int startTime) const;
+
+        int lastMeteringIntervalIndex(const int completionTime) const;
+
+        void addEnergyConsumption(const int start, const int end, const double powerConsumption);
+
+        void addMembership(const int fromIndex, const int toIndex, const int delta);
+
+    public:
+        EnergyProfile(const Instance &ins);
+
+        void clear();
+
+        void insert(const Operation &operation, const int startTime);
+
+        void remove(const Operation &operation, const int startTime);
+
+        void shift(const Operation &operation, const int fromStartTime, const int toStartTime);
+
+        double getEnergyConsumption(const int meteringIntervalIndex) const;
+
+        double getHeadroom(const int meteringIntervalIndex) const;
+
+        const MeteringInterval *findViolatedMeteringInterval(const double tolerance) const;
+
+        // First metering interval with index in [fromIndex, toIndex] whose limit is exceeded by more than tolerance.
+        const MeteringInterval *findViolatedMeteringInterval(const int fromIndex,
+                                                             const int toIndex,
+                                                             const double tolerance) const;
+
+        // Energy consumed in the metering interval by operations ordered[fromPosition..upToPosition] with
+        // non-decreasing start times, without building the profile.
+        static double computeEnergyConsumption(const vector<const Operation*> &ordered,
+                                               const StartTimes &startTimes,
+                                               const int fromPosition,
+                                               const int upToPosition,
+                                               const MeteringInterval &meteringInterval);
+    };
+}
+
+
+#endif //ROBUSTENERGYAWARESCHEDULING_ENERGYPROFILE_H
@@ -0,0 +1,65 @@
+/*
+    
+    Copyright (C) 2017 Czech Technical University in Prague
+    The MIT License (MIT)
+    
+    Permission is hereby granted, free of charge, to any person obtaining
+    a copy of this software and associated documentation files
+    (the "Software"), to deal in the Software without restriction,
+    including without limitation the rights to use, copy, modify, merge,
+    publish, distribute, sublicense, and/or sell copies of the Software,
+    and to permit persons to whom the Software is furnished to do so,
+    subject to the following conditions:
+    
+    The above copyright notice and this permission notice shall be
+    included in all copies or substantial portions of the Software.
+    
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+    EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+    MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+    IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+    CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+    TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+    SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+#ifndef ROBUSTENERGYAWARESCHEDULING_FENWICKTREE_H
+#define ROBUSTENERGYAWARESCHEDULING_FENWICKTREE_H
+
+#include <vector>
+
+namespace rseclp {
+    using namespace std;
+
+    // Prefix sums over a fixed number of positions with point updates, both in O(log size).
+    template<typename T>
+    class FenwickTree {
+    private:
+        vector<T> mTree;
+
+    public:
+        FenwickTree(const int size) : mTree(size + 1, T()) { }
+
+        void add(const int position, const T delta) {
+            for (int index = position + 1; index < (int)mTree.size(); index += index & -index) {
+                mTree[index] += delta;
+            }
+        }
+
+        // Sum of the positions [0, count).
+        T prefixSum(const int count) const {
+            T sum = T();
+            for (int index = count; index > 0; index -= index & -index) {
+                sum += mTree[index];
+            }
+            return sum;
+        }
+
+        T total() const {
+            return prefixSum((int)mTree.size() - 1);
+        }
+    };
+}
+
+
+#endif //ROBUSTENERGYAWARESCHEDULING_FENWICKTREE_H
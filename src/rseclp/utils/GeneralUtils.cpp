@@ -117,28 +117,4 @@ namespace rseclp {
         }
     }
 
-    double GeneralUtils::computeEnergyConsumptionInMeteringInterval(const vector<const Operation *> &ordered,
-                                                                    const StartTimes &startTimes,
-                                                                    int upToPosition,
-                                                                    const MeteringInterval &meteringInterval) {
-        double energyConsumption = 0.0;
-        for (int position = upToPosition; position >= 0; position--) {
-            const Operation &operation = *ordered[position];
-            int startTime = startTimes[operation.getIndex()];
-            int completionTime = startTime + operation.getProcessingTime();
-
-            if (completionTime <= meteringInterval.getStart()) {
-                break;
-            }
-
-            int intersectionLength = GeneralUtils::computeIntervalsIntersectionLength(meteringInterval.getStart(),
-                                                                                      meteringInterval.getEnd(),
-                                                                                      startTime,
-                                                                                      completionTime);
-            energyConsumption += intersectionLength * operation.getPowerConsumption();
-        }
-
-        return energyConsumption;
-    }
-
 }
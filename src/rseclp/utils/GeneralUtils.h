@@ -27,8 +27,8 @@
 #define ROBUSTENERGYAWARESCHEDULING_GENERALUTILS_H
 
 #include <algorithm>
+#include <random>
 #include <string>
-#include <gurobi_c++.h>
 #include <tuple>
 #include "MultiArray.h"
 #include "StartTimes.h"
@@ -119,11 +119,6 @@ namespace rseclp {
 
         const static MeteringInterval *lastNonZeroIntersectionMeteringInterval(const Instance &ins,
                                                                                const int completionTime);
-
-        static double computeEnergyConsumptionInMeteringInterval(const vector<const Operation *> &ordered,
-                                                                 const StartTimes &startTimes,
-                                                                 int upToPosition,
-                                                                 const MeteringInterval &meteringInterval);
     };
 
 }
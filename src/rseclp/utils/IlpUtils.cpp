@@ -43,20 +43,38 @@ namespace rseclp {
         return ss.str();
     }
 
-    MultiArray<int> IlpUtils::binaryVariablesToValues(const MultiArray<GRBVar> &vars) {
-        MultiArray<int> result(vars.shape(), 0);
-        auto &varsBackingArray = vars.backingArray();
-        for (int i = 0; i < (int)varsBackingArray.size(); i++) {
-            auto var = varsBackingArray[i];
-            if (var.sameAs(GRBVar())) {
-                result.directSet(i, -1);
-            }
-            else {
-                result.directSet(i, var.get(GRB_DoubleAttr_X) < 0.5 ? 0 : 1);
-            }
+    void IlpConstraintBatch::addTerm(const int var, double coeff) {
+        mRow.addTerm(var, coeff);
+    }
+
+    void IlpConstraintBatch::addTerms(const int *vars, double coeff, int count) {
+        mRow.addTerms(vars, coeff, count);
+    }
+
+    void IlpConstraintBatch::endRow(MilpSense sense, double rhs) {
+        addRow(mRow, sense, rhs);
+        mRow.clear();
+    }
+
+    void IlpConstraintBatch::addRow(const MilpLinExpr &expr, MilpSense sense, double rhs) {
+        mExprs.push_back(expr);
+        mSenses.push_back(sense);
+        mRhs.push_back(rhs);
+    }
+
+    int IlpConstraintBatch::size() const {
+        return (int)mExprs.size();
+    }
+
+    void IlpConstraintBatch::addTo(MilpModel &model) {
+        if (mExprs.empty()) {
+            return;
         }
 
-        return result;
+        model.addConstrs(mExprs, mSenses, mRhs);
+        mExprs.clear();
+        mSenses.clear();
+        mRhs.clear();
     }
 
 }
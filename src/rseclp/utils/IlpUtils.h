@@ -27,8 +27,8 @@
 #define ROBUSTENERGYAWARESCHEDULING_ILPUTILS_H
 
 #include <string>
-#include <gurobi_c++.h>
-#include "MultiArray.h"
+#include <vector>
+#include "../milp/MilpModel.h"
 
 namespace rseclp {
     using namespace std;
@@ -37,8 +37,29 @@ namespace rseclp {
     public:
         static string varName(const string name, initializer_list<int> indices);
 
-        static MultiArray<int> binaryVariablesToValues(const MultiArray<GRBVar> &vars);
+    };
+
+    // Linear constraints are assembled row by row from arrays of terms and added to the model in a single call.
+    class IlpConstraintBatch {
+    private:
+        vector<MilpLinExpr> mExprs;
+        vector<MilpSense> mSenses;
+        vector<double> mRhs;
+
+        MilpLinExpr mRow;
+
+    public:
+        void addTerm(const int var, double coeff);
+
+        void addTerms(const int *vars, double coeff, int count);
+
+        void endRow(MilpSense sense, double rhs);
+
+        void addRow(const MilpLinExpr &expr, MilpSense sense, double rhs);
+
+        int size() const;
 
+        void addTo(MilpModel &model);
     };
 }
 
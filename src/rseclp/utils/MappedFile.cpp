@@ -0,0 +1,84 @@
+/*
+    
+    Copyright (C) 2017 Czech Technical University in Prague
+    The MIT License (MIT)
+    
+    Permission is hereby granted, free of charge, to any person obtaining
+    a copy of this software and associated documentation files
+    (the "Software"), to deal in the Software without restriction,
+    including without limitation the rights to use, copy, modify, merge,
+    publish, distribute, sublicense, and/or sell copies of the Software,
+    and to permit persons to whom the Software is furnished to do so,
+    subject to the following conditions:
+    
+    The above copyright notice and this permission notice shall be
+    included in all copies or substantial portions of the Software.
+    
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+    EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+    MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+    IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+    CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+    TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+    SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <cerrno>
+#include <cstring>
+#include <sstream>
+#include <stdexcept>
+#include "MappedFile.h"
+
+namespace rseclp {
+
+    MappedFile::MappedFile(const path &filePath) : mData(nullptr), mSize(0) {
+        int fd = open(filePath.c_str(), O_RDONLY);
+        if (fd == -1) {
+            std::stringstream msg;
+            msg << "File '" << filePath << "' cannot be opened: " << strerror(errno) << "." << endl;
+            throw std::invalid_argument(msg.str());
+        }
+
+        struct stat fileStat;
+        if (fstat(fd, &fileStat) == -1) {
+            close(fd);
+            std::stringstream msg;
+            msg << "File '" << filePath << "' cannot be stat-ed: " << strerror(errno) << "." << endl;
+            throw std::runtime_error(msg.str());
+        }
+
+        mSize = static_cast<size_t>(fileStat.st_size);
+
+        // Empty file cannot be mapped, the readers will report it as truncated.
+        if (mSize > 0) {
+            void *data = mmap(nullptr, mSize, PROT_READ, MAP_PRIVATE, fd, 0);
+            if (data == MAP_FAILED) {
+                close(fd);
+                std::stringstream msg;
+                msg << "File '" << filePath << "' cannot be mapped: " << strerror(errno) << "." << endl;
+                throw std::runtime_error(msg.str());
+            }
+            mData = static_cast<const char*>(data);
+        }
+
+        close(fd);
+    }
+
+    MappedFile::~MappedFile() {
+        if (mData != nullptr) {
+            munmap(const_cast<char*>(mData), mSize);
+        }
+    }
+
+    const char *MappedFile::getData() const {
+        return mData;
+    }
+
+    size_t MappedFile::getSize() const {
+        return mSize;
+    }
+}
@@ -23,34 +23,38 @@
     SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 */
 
-#ifndef ROBUSTENERGYAWARESCHEDULING_ROBUSTSCHEDULEFIXEDORDERDEFAULT_H
-#define ROBUSTENERGYAWARESCHEDULING_ROBUSTSCHEDULEFIXEDORDERDEFAULT_H
+#ifndef ROBUSTENERGYAWARESCHEDULING_MAPPEDFILE_H
+#define ROBUSTENERGYAWARESCHEDULING_MAPPEDFILE_H
 
-
-#include "../../instance/Instance.h"
-#include "../../utils/StartTimes.h"
-#include "../../solvers/Solver.h"
-
-#ifdef _2016B
-#include "../../solvers/fixed-order/RobustScheduleFixedOrder2016B.h"
-#else
-#include "../../solvers/fixed-order/RobustScheduleFixedOrderOptimised.h"
-#endif
+#include <cstddef>
+#include <boost/filesystem.hpp>
 
 namespace rseclp {
+
     using namespace std;
+    using namespace boost::filesystem;
 
-#ifdef _2016B
-    class RobustScheduleFixedOrderDefault : public RobustScheduleFixedOrder2016B {
-#else
-    class RobustScheduleFixedOrderDefault : public RobustScheduleFixedOrderOptimised {
-#endif
+    // Read-only memory mapping of a whole file, unmapped on destruction.
+    class MappedFile {
+    private:
+        const char *mData;
+        size_t mSize;
 
     public:
-        RobustScheduleFixedOrderDefault(const Instance &ins);
+        explicit MappedFile(const path &filePath);
+
+        MappedFile(const MappedFile&) = delete;
+
+        MappedFile &operator=(const MappedFile&) = delete;
+
+        ~MappedFile();
+
+        const char *getData() const;
+
+        size_t getSize() const;
     };
 
 }
 
 
-#endif //ROBUSTENERGYAWARESCHEDULING_ROBUSTSCHEDULEFIXEDORDERDEFAULT_H
+#endif //ROBUSTENERGYAWARESCHEDULING_MAPPEDFILE_H
@@ -0,0 +1,113 @@
+/*
+    
+    Copyright (C) 2017 Czech Technical University in Prague
+    The MIT License (MIT)
+    
+    Permission is hereby granted, free of charge, to any person obtaining
+    a copy of this software and associated documentation files
+    (the "Software"), to deal in the Software without restriction,
+    including without limitation the rights to use, copy, modify, merge,
+    publish, distribute, sublicense, and/or sell copies of the Software,
+    and to permit persons to whom the Software is furnished to do so,
+    subject to the following conditions:
+    
+    The above copyright notice and this permission notice shall be
+    included in all copies or substantial portions of the Software.
+    
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+    EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+    MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+    IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+    CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+    TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+    SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+#include "Profiler.h"
+
+#ifdef RSECLP_PROFILE
+
+#include <chrono>
+#include <mutex>
+#include <vector>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+
+namespace rseclp {
+
+    namespace {
+        // Phases are static locals of the instrumented functions, so they live until the end of the program.
+        mutex &getPhasesMutex() {
+            static mutex phasesMutex;
+            return phasesMutex;
+        }
+
+        vector<Profiler::Phase*> &getPhases() {
+            static vector<Profiler::Phase*> phases;
+            return phases;
+        }
+
+        int computeBucket(uint64_t numIterations) {
+            int bucket = 0;
+            while (numIterations > 0 && bucket < Profiler::NUM_BUCKETS - 1) {
+                numIterations >>= 1;
+                bucket++;
+            }
+            return bucket;
+        }
+    }
+
+    Profiler::Phase::Phase(const string name) : mName(name), mNumCalls(0), mNumCycles(0), mNumIterations(0) {
+        for (auto &count : mHistogram) {
+            count.store(0);
+        }
+
+        lock_guard<mutex> lock(getPhasesMutex());
+        getPhases().push_back(this);
+    }
+
+    void Profiler::Phase::record(const uint64_t numCycles, const uint64_t numIterations) {
+        mNumCalls.fetch_add(1, memory_order_relaxed);
+        mNumCycles.fetch_add(numCycles, memory_order_relaxed);
+        mNumIterations.fetch_add(numIterations, memory_order_relaxed);
+        mHistogram[computeBucket(numIterations)].fetch_add(1, memory_order_relaxed);
+    }
+
+    uint64_t Profiler::readCycles() {
+#if defined(__x86_64__) || defined(__i386__)
+        return __rdtsc();
+#else
+        return static_cast<uint64_t>(chrono::duration_cast<chrono::nanoseconds>(
+                chrono::steady_clock::now().time_since_epoch()).count());
+#endif
+    }
+
+    void Profiler::dump(ostream &out) {
+        lock_guard<mutex> lock(getPhasesMutex());
+        out << "Profile (cycles include the nested phases):" << endl;
+        for (auto phase : getPhases()) {
+            uint64_t numCalls = phase->mNumCalls.load();
+            uint64_t numCycles = phase->mNumCycles.load();
+            out << "  " << phase->mName
+                << ": calls " << numCalls
+                << ", cycles " << numCycles
+                << ", cycles per call " << (numCalls > 0 ? numCycles / numCalls : 0)
+                << ", iterations " << phase->mNumIterations.load() << endl;
+
+            // Iterations per call, the bucket is printed by its lower end.
+            out << "    iterations histogram:";
+            for (int bucket = 0; bucket < NUM_BUCKETS; bucket++) {
+                uint64_t count = phase->mHistogram[bucket].load();
+                if (count > 0) {
+                    out << " " << (bucket == 0 ? 0 : (uint64_t)1 << (bucket - 1))
+                        << (bucket == NUM_BUCKETS - 1 ? "+" : "") << ":" << count;
+                }
+            }
+            out << endl;
+        }
+    }
+}
+
+#endif
@@ -0,0 +1,118 @@
+/*
+    
+    Copyright (C) 2017 Czech Technical University in Prague
+    The MIT License (MIT)
+    
+    Permission is hereby granted, free of charge, to any person obtaining
+    a copy of this software and associated documentation files
+    (the "Software"), to deal in the Software without restriction,
+    including without limitation the rights to use, copy, modify, merge,
+    publish, distribute, sublicense, and/or sell copies of the Software,
+    and to permit persons to whom the Software is furnished to do so,
+    subject to the following conditions:
+    
+    The above copyright notice and this permission notice shall be
+    included in all copies or substantial portions of the Software.
+    
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+    EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+    MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+    IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+    CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+    TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+    SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+#ifndef ROBUSTENERGYAWARESCHEDULING_PROFILER_H
+#define ROBUSTENERGYAWARESCHEDULING_PROFILER_H
+
+// Scoped instrumentation of the hot phases, compiled in only with RSECLP_PROFILE (CMake option of the same name).
+// Without it, the macros expand to nothing and their arguments are not evaluated.
+//
+//     RSECLP_PROFILE_SCOPE(scope, "phase name");      counts the calls and cycles until the end of the block
+//     RSECLP_PROFILE_ITERATE(scope);                  counts one loop iteration of the scope
+//     RSECLP_PROFILE_ITERATE_BY(scope, n);            counts n loop iterations of the scope
+//     RSECLP_PROFILE_DUMP(out);                       writes the statistics of all phases to the stream
+
+#ifdef RSECLP_PROFILE
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <ostream>
+#include <string>
+
+namespace rseclp {
+
+    using namespace std;
+
+    class Profiler {
+    public:
+        // Histogram buckets of the iterations per call: 0, 1, 2-3, 4-7, ..., the last one is unbounded.
+        static const int NUM_BUCKETS = 16;
+
+        // Statistics of a phase over the whole run, updated by all threads.
+        class Phase {
+        private:
+            const string mName;
+            atomic<uint64_t> mNumCalls;
+            atomic<uint64_t> mNumCycles;
+            atomic<uint64_t> mNumIterations;
+            array<atomic<uint64_t>, NUM_BUCKETS> mHistogram;
+
+            friend class Profiler;
+
+        public:
+            Phase(const string name);
+
+            void record(const uint64_t numCycles, const uint64_t numIterations);
+        };
+
+        class Scope {
+        private:
+            Phase &mPhase;
+            const uint64_t mStart;
+            uint64_t mNumIterations;
+
+        public:
+            Scope(Phase &phase) : mPhase(phase), mStart(readCycles()), mNumIterations(0) { }
+
+            ~Scope() {
+                mPhase.record(readCycles() - mStart, mNumIterations);
+            }
+
+            void iterate(const uint64_t numIterations) {
+                mNumIterations += numIterations;
+            }
+
+            Scope(const Scope&) = delete;
+
+            Scope &operator=(const Scope&) = delete;
+        };
+
+        // Time stamp counter, or nanoseconds of the steady clock where it is not available.
+        static uint64_t readCycles();
+
+        static void dump(ostream &out);
+    };
+
+}
+
+#define RSECLP_PROFILE_SCOPE(scope, name) \
+    static rseclp::Profiler::Phase scope##Phase(name); \
+    rseclp::Profiler::Scope scope(scope##Phase)
+#define RSECLP_PROFILE_ITERATE(scope) scope.iterate(1)
+#define RSECLP_PROFILE_ITERATE_BY(scope, numIterations) scope.iterate(static_cast<uint64_t>(numIterations))
+#define RSECLP_PROFILE_DUMP(out) rseclp::Profiler::dump(out)
+
+#else
+
+#define RSECLP_PROFILE_SCOPE(scope, name)
+#define RSECLP_PROFILE_ITERATE(scope)
+#define RSECLP_PROFILE_ITERATE_BY(scope, numIterations)
+#define RSECLP_PROFILE_DUMP(out)
+
+#endif
+
+
+#endif //ROBUSTENERGYAWARESCHEDULING_PROFILER_H
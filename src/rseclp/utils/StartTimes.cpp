@@ -24,7 +24,7 @@
 */
 
 #include <algorithm>
-#include "GeneralUtils.h"
+#include "EnergyProfile.h"
 #include "StartTimes.h"
 
 namespace rseclp {
@@ -54,47 +54,12 @@ namespace rseclp {
     }
 
     const MeteringInterval *StartTimes::getViolatedMeteringInterval(const Instance &ins) const {
-        vector<double> energyConsumptionPerInterval(ins.getNumMeteringIntervals(), 0.0);
+        EnergyProfile energyProfile(ins);
         for (auto *pOperation : ins.getOperations()) {
-            const Operation &operation = *pOperation;
-
-            int startTime = mStartTimes[operation.getIndex()];
-            int completionTime = mStartTimes[operation.getIndex()] + operation.getProcessingTime();
-            auto &firstMeteringInterval = *GeneralUtils::firstNonZeroIntersectionMeteringInterval(ins, startTime);
-            auto &lastMeteringInterval = *GeneralUtils::lastNonZeroIntersectionMeteringInterval(ins, completionTime);
-
-            if (firstMeteringInterval.getIndex() == lastMeteringInterval.getIndex()) {
-                energyConsumptionPerInterval[firstMeteringInterval.getIndex()] +=
-                        operation.getProcessingTime() * operation.getPowerConsumption();
-            }
-            else {
-                int intersection = 0;
-
-                intersection = firstMeteringInterval.getEnd() - startTime;
-                energyConsumptionPerInterval[firstMeteringInterval.getIndex()] +=
-                        intersection * operation.getPowerConsumption();
-
-                intersection = completionTime - lastMeteringInterval.getStart();
-                energyConsumptionPerInterval[lastMeteringInterval.getIndex()] +=
-                        intersection * operation.getPowerConsumption();
-            }
-
-            for (int meteringIntervalIndex = firstMeteringInterval.getIndex() + 1; meteringIntervalIndex < lastMeteringInterval.getIndex(); meteringIntervalIndex++) {
-                int intersection = ins.getLengthMeteringInterval();
-                energyConsumptionPerInterval[meteringIntervalIndex] +=
-                        intersection * operation.getPowerConsumption();
-            }
-        }
-
-        for (auto pMeteringInterval : ins.getMeteringIntervals()) {
-            const MeteringInterval &meteringInterval = *pMeteringInterval;
-            if (GeneralUtils::isGreater(energyConsumptionPerInterval[meteringInterval.getIndex()],
-                                        meteringInterval.getMaxEnergyConsumption(), 0.1)) {
-                return pMeteringInterval;
-            }
+            energyProfile.insert(*pOperation, mStartTimes[pOperation->getIndex()]);
         }
 
-        return nullptr;
+        return energyProfile.findViolatedMeteringInterval(0.1);
     }
 
     int &StartTimes::operator[](const Operation &operation) {
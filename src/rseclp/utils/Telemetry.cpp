@@ -0,0 +1,152 @@
+/*
+    
+    Copyright (C) 2017 Czech Technical University in Prague
+    The MIT License (MIT)
+    
+    Permission is hereby granted, free of charge, to any person obtaining
+    a copy of this software and associated documentation files
+    (the "Software"), to deal in the Software without restriction,
+    including without limitation the rights to use, copy, modify, merge,
+    publish, distribute, sublicense, and/or sell copies of the Software,
+    and to permit persons to whom the Software is furnished to do so,
+    subject to the following conditions:
+    
+    The above copyright notice and this permission notice shall be
+    included in all copies or substantial portions of the Software.
+    
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+    EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+    MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+    IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+    CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+    TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+    SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+#include <cstdlib>
+#include <new>
+#include "Telemetry.h"
+
+namespace rseclp {
+
+    thread_local Telemetry::Accumulator Telemetry::sAccumulator;
+
+    Telemetry::Registry::Registry(const bool timersEnabled) : mTimersEnabled(timersEnabled) {
+        mCounters.fill(0);
+        mClocks.fill(0);
+    }
+
+    Telemetry Telemetry::Registry::collect() {
+        if (sAccumulator.mRegistry == this) {
+            flush();
+        }
+
+        lock_guard<mutex> lock(mMutex);
+        Telemetry telemetry;
+        telemetry.mCounters = mCounters;
+        telemetry.mClocks = mClocks;
+        return telemetry;
+    }
+
+    Telemetry::Scope::Scope(Registry *registry)
+            : mPreviousRegistry(sAccumulator.mRegistry),
+              mPreviousTimersEnabled(sAccumulator.mTimersEnabled) {
+        flush();
+        sAccumulator.mRegistry = registry;
+        sAccumulator.mTimersEnabled = registry != nullptr && registry->mTimersEnabled;
+    }
+
+    Telemetry::Scope::~Scope() {
+        flush();
+        sAccumulator.mRegistry = mPreviousRegistry;
+        sAccumulator.mTimersEnabled = mPreviousTimersEnabled;
+    }
+
+    Telemetry::Telemetry() {
+        mCounters.fill(0);
+        mClocks.fill(0);
+    }
+
+    Telemetry::Registry *Telemetry::getRegistry() {
+        return sAccumulator.mRegistry;
+    }
+
+    bool Telemetry::areTimersEnabled() {
+        return sAccumulator.mTimersEnabled;
+    }
+
+    const string &Telemetry::getCounterName(const Counter counter) {
+        static const array<string, NUM_COUNTERS> NAMES = {{
+                "fixedOrderAppends",
+                "feasibilityChecks",
+                "nodes",
+                "cuts",
+                "allocations"
+        }};
+        return NAMES[counter];
+    }
+
+    const string &Telemetry::getClockName(const Clock clock) {
+        static const array<string, NUM_CLOCKS> NAMES = {{
+                "engineTimeInNanoseconds",
+                "boundTimeInNanoseconds",
+                "ioTimeInNanoseconds"
+        }};
+        return NAMES[clock];
+    }
+
+    long long Telemetry::getCounter(const Counter counter) const {
+        return mCounters[counter];
+    }
+
+    chrono::nanoseconds Telemetry::getClock(const Clock clock) const {
+        return chrono::nanoseconds(mClocks[clock]);
+    }
+
+    Telemetry &Telemetry::operator+=(const Telemetry &other) {
+        for (int counter = 0; counter < NUM_COUNTERS; counter++) {
+            mCounters[counter] += other.mCounters[counter];
+        }
+        for (int clock = 0; clock < NUM_CLOCKS; clock++) {
+            mClocks[clock] += other.mClocks[clock];
+        }
+        return *this;
+    }
+
+    void Telemetry::flush() {
+        // Counts of a thread without a registry are dropped.
+        Registry *registry = sAccumulator.mRegistry;
+        if (registry != nullptr) {
+            lock_guard<mutex> lock(registry->mMutex);
+            for (int counter = 0; counter < NUM_COUNTERS; counter++) {
+                registry->mCounters[counter] += sAccumulator.mCounters[counter];
+            }
+            for (int clock = 0; clock < NUM_CLOCKS; clock++) {
+                registry->mClocks[clock] += sAccumulator.mClocks[clock];
+            }
+        }
+
+        for (int counter = 0; counter < NUM_COUNTERS; counter++) {
+            sAccumulator.mCounters[counter] = 0;
+        }
+        for (int clock = 0; clock < NUM_CLOCKS; clock++) {
+            sAccumulator.mClocks[clock] = 0;
+        }
+    }
+}
+
+#ifdef RSECLP_TELEMETRY_ALLOCATIONS
+// Replaces the global allocation functions, the array forms forward to these.
+void *operator new(std::size_t size) {
+    rseclp::Telemetry::count(rseclp::Telemetry::ALLOCATIONS);
+    void *pointer = std::malloc(size > 0 ? size : 1);
+    if (pointer == nullptr) {
+        throw std::bad_alloc();
+    }
+    return pointer;
+}
+
+void operator delete(void *pointer) noexcept {
+    std::free(pointer);
+}
+#endif
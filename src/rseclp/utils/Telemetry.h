@@ -0,0 +1,160 @@
+/*
+    
+    Copyright (C) 2017 Czech Technical University in Prague
+    The MIT License (MIT)
+    
+    Permission is hereby granted, free of charge, to any person obtaining
+    a copy of this software and associated documentation files
+    (the "Software"), to deal in the Software without restriction,
+    including without limitation the rights to use, copy, modify, merge,
+    publish, distribute, sublicense, and/or sell copies of the Software,
+    and to permit persons to whom the Software is furnished to do so,
+    subject to the following conditions:
+    
+    The above copyright notice and this permission notice shall be
+    included in all copies or substantial portions of the Software.
+    
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+    EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+    MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+    IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+    CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+    TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+    SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+#ifndef ROBUSTENERGYAWARESCHEDULING_TELEMETRY_H
+#define ROBUSTENERGYAWARESCHEDULING_TELEMETRY_H
+
+#include <array>
+#include <chrono>
+#include <mutex>
+#include <string>
+
+namespace rseclp {
+
+    using namespace std;
+
+    // Counters and times of a solver run. The instrumented code updates thread-local accumulators, which are flushed
+    // into the registry attached to the thread, so the counting does not need any synchronisation.
+    class Telemetry {
+    public:
+        enum Counter {
+            // Positions appended by the fixed-order engines, so an order built from scratch counts its length and an
+            // order extended by one operation counts one.
+            FIXED_ORDER_APPENDS = 0,
+            FEASIBILITY_CHECKS,
+            NODES,
+            CUTS,
+            // Counted only when built with RSECLP_TELEMETRY_ALLOCATIONS.
+            ALLOCATIONS,
+            NUM_COUNTERS
+        };
+
+        enum Clock {
+            ENGINE_TIME = 0,
+            BOUND_TIME,
+            IO_TIME,
+            NUM_CLOCKS
+        };
+
+        class Registry {
+        private:
+            const bool mTimersEnabled;
+            mutex mMutex;
+            array<long long, NUM_COUNTERS> mCounters;
+            array<long long, NUM_CLOCKS> mClocks;
+
+            friend class Telemetry;
+
+        public:
+            // Reading the clock is not free, so the timers are measured only on request.
+            Registry(const bool timersEnabled);
+
+            // Accumulators of the threads still attached to the registry (except the calling one) are not included.
+            Telemetry collect();
+        };
+
+        // Attaches the calling thread to the registry for the lifetime of the scope. Worker threads of a solver
+        // attach to the registry of the thread that started them (see getRegistry()).
+        class Scope {
+        private:
+            Registry *mPreviousRegistry;
+            bool mPreviousTimersEnabled;
+
+        public:
+            Scope(Registry *registry);
+
+            ~Scope();
+
+            Scope(const Scope&) = delete;
+
+            Scope &operator=(const Scope&) = delete;
+        };
+
+        class ScopedTimer {
+        private:
+            const Clock mClock;
+            const bool mEnabled;
+            chrono::time_point<chrono::steady_clock> mStart;
+
+        public:
+            ScopedTimer(const Clock clock) : mClock(clock), mEnabled(sAccumulator.mTimersEnabled) {
+                if (mEnabled) {
+                    mStart = chrono::steady_clock::now();
+                }
+            }
+
+            ~ScopedTimer() {
+                if (mEnabled) {
+                    auto elapsed = chrono::duration_cast<chrono::nanoseconds>(chrono::steady_clock::now() - mStart);
+                    sAccumulator.mClocks[mClock] += elapsed.count();
+                }
+            }
+
+            ScopedTimer(const ScopedTimer&) = delete;
+
+            ScopedTimer &operator=(const ScopedTimer&) = delete;
+        };
+
+        Telemetry();
+
+        static void count(const Counter counter, const long long value = 1) {
+            sAccumulator.mCounters[counter] += value;
+        }
+
+        static Registry *getRegistry();
+
+        static bool areTimersEnabled();
+
+        static const string &getCounterName(const Counter counter);
+
+        static const string &getClockName(const Clock clock);
+
+        long long getCounter(const Counter counter) const;
+
+        chrono::nanoseconds getClock(const Clock clock) const;
+
+        Telemetry &operator+=(const Telemetry &other);
+
+    private:
+        // Plain data, so that it is zero-initialised and accessible without any guard, even from operator new.
+        struct Accumulator {
+            long long mCounters[NUM_COUNTERS];
+            long long mClocks[NUM_CLOCKS];
+            Registry *mRegistry;
+            bool mTimersEnabled;
+        };
+
+        static thread_local Accumulator sAccumulator;
+
+        array<long long, NUM_COUNTERS> mCounters;
+        array<long long, NUM_CLOCKS> mClocks;
+
+        static void flush();
+    };
+
+}
+
+
+#endif //ROBUSTENERGYAWARESCHEDULING_TELEMETRY_H
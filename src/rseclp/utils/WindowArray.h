@@ -0,0 +1,102 @@
+/*
+    
+    Copyright (C) 2017 Czech Technical University in Prague
+    The MIT License (MIT)
+    
+    Permission is hereby granted, free of charge, to any person obtaining
+    a copy of this software and associated documentation files
+    (the "Software"), to deal in the Software without restriction,
+    including without limitation the rights to use, copy, modify, merge,
+    publish, distribute, sublicense, and/or sell copies of the Software,
+    and to permit persons to whom the Software is furnished to do so,
+    subject to the following conditions:
+    
+    The above copyright notice and this permission notice shall be
+    included in all copies or substantial portions of the Software.
+    
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+    EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+    MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+    IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+    CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+    TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+    SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+#ifndef ROBUSTENERGYAWARESCHEDULING_WINDOWARRAY_H
+#define ROBUSTENERGYAWARESCHEDULING_WINDOWARRAY_H
+
+#include <vector>
+#include <cassert>
+
+namespace rseclp {
+    using namespace std;
+
+    // Two-dimensional array where row i stores only the columns in its window [columnMin_i, columnMax_i].
+    // The rows are stored contiguously in a single backing array.
+    template<typename T>
+    class WindowArray {
+    private:
+        vector<T> mArray;
+        vector<int> mRowOffsets;
+        vector<int> mColumnMins;
+        vector<int> mColumnMaxs;
+
+    public:
+        WindowArray() { }
+
+        WindowArray(const vector<int> &columnMins, const vector<int> &columnMaxs, T fillWith)
+                : mColumnMins(columnMins), mColumnMaxs(columnMaxs) {
+            assert(columnMins.size() == columnMaxs.size());
+
+            int numEntries = 0;
+            mRowOffsets.reserve(columnMins.size());
+            for (int row = 0; row < (int)columnMins.size(); row++) {
+                mRowOffsets.push_back(numEntries);
+                numEntries += max(0, columnMaxs[row] - columnMins[row] + 1);
+            }
+            mArray = vector<T>(numEntries, fillWith);
+        }
+
+        bool contains(const int row, const int column) const {
+            return mColumnMins[row] <= column && column <= mColumnMaxs[row];
+        }
+
+        T &operator()(const int row, const int column) {
+            assert(contains(row, column));
+            return mArray[mRowOffsets[row] + column - mColumnMins[row]];
+        }
+
+        const T &operator()(const int row, const int column) const {
+            assert(contains(row, column));
+            return mArray[mRowOffsets[row] + column - mColumnMins[row]];
+        }
+
+        int columnMin(const int row) const {
+            return mColumnMins[row];
+        }
+
+        int columnMax(const int row) const {
+            return mColumnMaxs[row];
+        }
+
+        int numRows() const {
+            return (int)mColumnMins.size();
+        }
+
+        int size() const {
+            return (int)mArray.size();
+        }
+
+        T *data() {
+            return mArray.data();
+        }
+
+        const vector<T> &backingArray() const {
+            return mArray;
+        }
+    };
+}
+
+
+#endif //ROBUSTENERGYAWARESCHEDULING_WINDOWARRAY_H